@@ -0,0 +1,439 @@
+// Benchmark do ACO sobre instâncias sintéticas das classes de Pisinger.
+//
+// Compilação (a partir da raiz do repositório; mesmas flags de aviso do programa principal):
+//   make benchmark    # gera build/benchmark
+//
+// Uso:
+//   build/benchmark [--tamanhos 100,1000,...] [--classes uncorrelated,subset_sum,...]
+//                    [--formigas N] [--iteracoes N] [--threads N] [--seed N] [--alvo 0.99]
+//                    [--ilhas N] [--topologia anel|completa] [--migracao K] [--mistura 0.0] [--reducao 0|1]
+//                    [--tempo-exato 2.0] [--busca-local K]
+//                    [--variante padrao|as|elitista|rank|mmas|expoente_rapido]
+//                    [--repetidas desligado|iteracao|global] [--deposito-unico 0|1] [--delta 0.05]
+//
+// Cada caso gera uma linha JSON (JSON Lines) na saída padrão, para comparar commits
+// automaticamente. O alvo de qualidade é uma fração do limite superior de Dantzig, e o
+// tempo até o alvo vem de uma segunda execução com a mesma seed no modo anytime.
+// Os tempos por fase (e "formigas_por_s") vêm dos ciclos da instrumentação: compilado com
+// -DACO_INSTRUMENTATION=0 eles saem como null.
+// Com --ilhas N > 1, o mesmo orçamento de formigas por iteração é dividido entre N colônias
+// (modelo de ilhas) e o tempo até o alvo das ilhas é reportado ao lado do da colônia única.
+// Com --reducao 1 o ACO roda só sobre o núcleo que sobra após a fixação por limites.
+// O ótimo de referência vem do solver exato (DP ou branch-and-bound limitado por --tempo-exato);
+// "otimo_provado" diz se o limite de tempo foi respeitado sem cortar a busca.
+// Com --busca-local K as K melhores formigas de cada iteração passam pela busca local; o tempo
+// até o alvo já inclui o custo dela (tempo líquido), reportado à parte na instrumentação.
+// --variante escolhe a regra de atualização / expoentes da colônia única (ver aco_variants.h);
+// as ilhas continuam usando o ACO padrão.
+// --repetidas (padrão: desligado) e --deposito-unico configuram o cache de soluções repetidas; "taxa_repetidas" é a
+// fração das formigas construídas que ele dispensou de reavaliar.
+// Com --delta F a instância é alterada (perturbInstance, fração F dos itens) depois da execução
+// completa e resolvida de novo, do zero e a partir do checkpoint da execução anterior (warm
+// start). O alvo é o valor final da execução do zero: compara-se em que iteração cada uma chega nele.
+
+#include "aco.h"
+#include "aco_variants.h"
+#include "utils.h"
+#include "instance_generator.h"
+#include "island_model.h"
+#include "reduction.h"
+#include "exact_solver.h"
+#include "aco_checkpoint.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <thread>
+#include <sys/resource.h>  // getrusage
+
+namespace {
+
+// Combinações de políticas disponíveis para a colônia única
+enum class AcoVariant { Default, AntSystem, Elitist, RankBased, MaxMin, FastExponent };
+
+struct AcoVariantName {
+    AcoVariant variant;
+    const char* name;
+};
+
+const AcoVariantName kAcoVariantNames[] = {
+    {AcoVariant::Default, "padrao"},    {AcoVariant::AntSystem, "as"},
+    {AcoVariant::Elitist, "elitista"},  {AcoVariant::RankBased, "rank"},
+    {AcoVariant::MaxMin, "mmas"},       {AcoVariant::FastExponent, "expoente_rapido"},
+};
+
+const char* acoVariantName(AcoVariant variant) {
+    for (const AcoVariantName& entry : kAcoVariantNames) {
+        if (entry.variant == variant) {
+            return entry.name;
+        }
+    }
+    return "desconhecida";
+}
+
+bool parseAcoVariant(const std::string& name, AcoVariant& variant) {
+    for (const AcoVariantName& entry : kAcoVariantNames) {
+        if (name == entry.name) {
+            variant = entry.variant;
+            return true;
+        }
+    }
+    return false;
+}
+
+struct BenchmarkConfig {
+    std::vector<int> sizes = {100, 1000, 10000, 100000, 1000000};
+    std::vector<InstanceClass> classes = allInstanceClasses();
+    int numAnts = 20;
+    int maxIterations = 25;
+    int numThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    unsigned int seed = 12345;
+    double targetFraction = 0.99;
+    double evaporationRate = 0.3;
+    double alpha = 1.5;
+    double beta = 2.5;
+    IslandConfig islands = IslandConfig{1, 10, MigrationTopology::Ring, 0.0};
+    bool coreReduction = false;
+    double exactTimeLimitSeconds = 2.0;
+    int localSearchElites = 0;
+    AcoVariant variant = AcoVariant::Default;
+    DuplicateCacheMode duplicateCache = DuplicateCacheMode::Off;
+    bool uniqueDeposits = false;
+    double deltaFraction = 0.0;
+};
+
+std::vector<std::string> splitList(const std::string& text) {
+    std::vector<std::string> parts;
+    std::stringstream ss(text);
+    std::string part;
+    while (std::getline(ss, part, ',')) {
+        if (!part.empty()) {
+            parts.push_back(part);
+        }
+    }
+    return parts;
+}
+
+bool parseArguments(int argc, char* argv[], BenchmarkConfig& config) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Argumento sem valor: " << arg << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+        if (arg == "--tamanhos") {
+            config.sizes.clear();
+            for (const std::string& s : splitList(value)) {
+                config.sizes.push_back(std::stoi(s));
+            }
+        } else if (arg == "--classes") {
+            config.classes.clear();
+            for (const std::string& s : splitList(value)) {
+                InstanceClass instanceClass;
+                if (!parseInstanceClass(s, instanceClass)) {
+                    std::cerr << "Classe desconhecida: " << s << std::endl;
+                    return false;
+                }
+                config.classes.push_back(instanceClass);
+            }
+        } else if (arg == "--formigas") {
+            config.numAnts = std::stoi(value);
+        } else if (arg == "--iteracoes") {
+            config.maxIterations = std::stoi(value);
+        } else if (arg == "--threads") {
+            config.numThreads = std::stoi(value);
+        } else if (arg == "--seed") {
+            config.seed = static_cast<unsigned int>(std::stoul(value));
+        } else if (arg == "--alvo") {
+            config.targetFraction = std::stod(value);
+        } else if (arg == "--busca-local") {
+            config.localSearchElites = std::stoi(value);
+        } else if (arg == "--tempo-exato") {
+            config.exactTimeLimitSeconds = std::stod(value);
+        } else if (arg == "--variante") {
+            if (!parseAcoVariant(value, config.variant)) {
+                std::cerr << "Variante desconhecida: " << value << std::endl;
+                return false;
+            }
+        } else if (arg == "--repetidas") {
+            if (!parseDuplicateCacheMode(value, config.duplicateCache)) {
+                std::cerr << "Modo de cache de repetidas desconhecido: " << value << std::endl;
+                return false;
+            }
+        } else if (arg == "--deposito-unico") {
+            config.uniqueDeposits = (std::stoi(value) != 0);
+        } else if (arg == "--delta") {
+            config.deltaFraction = std::stod(value);
+        } else if (arg == "--reducao") {
+            config.coreReduction = (std::stoi(value) != 0);
+        } else if (arg == "--ilhas") {
+            config.islands.numIslands = std::stoi(value);
+        } else if (arg == "--migracao") {
+            config.islands.migrationInterval = std::stoi(value);
+        } else if (arg == "--mistura") {
+            config.islands.pheromoneBlend = std::stod(value);
+        } else if (arg == "--topologia") {
+            if (!parseMigrationTopology(value, config.islands.topology)) {
+                std::cerr << "Topologia desconhecida: " << value << std::endl;
+                return false;
+            }
+        } else {
+            std::cerr << "Argumento desconhecido: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+long peakMemoryKb() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;  // Em KB no Linux
+}
+
+// Resultado das duas execuções da colônia única (orçamento completo e parada no alvo)
+// Re-solução da instância alterada por --delta, do zero e a partir do checkpoint
+struct DeltaRun {
+    bool ran = false;
+    int target = 0;  // Valor final da execução do zero
+    SolveResult cold;
+    SolveResult warm;
+};
+
+struct ColonyRun {
+    int bestValue;
+    double totalSeconds;  // Desde start até o fim da primeira execução
+    AcoInstrumentation instrumentation;
+    SolveResult targetResult;
+    DeltaRun delta;
+};
+
+template <class Engine>
+DeltaRun runDelta(const BenchmarkConfig& config, int capacity, const std::vector<Item>& items,
+                  const AcoCheckpoint& snapshot) {
+    DeltaRun delta;
+    std::pair<int, std::vector<Item>> changed = perturbInstance(capacity, items, config.deltaFraction, config.seed + 1);
+    delta.ran = true;
+
+    std::shared_ptr<const LocalSearch> localSearch;
+    if (config.localSearchElites > 0) {
+        localSearch = std::make_shared<SwapLocalSearch>(changed.first, changed.second);
+    }
+
+    Engine cold(config.numAnts, config.evaporationRate, config.alpha, config.beta, changed.first, changed.second,
+                config.maxIterations, config.seed, config.numThreads);
+    Engine warm(config.numAnts, config.evaporationRate, config.alpha, config.beta, changed.first, changed.second,
+                config.maxIterations, snapshot, config.numThreads);
+    for (Engine* aco : {&cold, &warm}) {
+        aco->setLocalSearch(localSearch, config.localSearchElites);
+        aco->setDuplicateCache(config.duplicateCache, config.uniqueDeposits);
+    }
+    delta.cold = cold.solve(SolveLimits());
+    SolveLimits limits;
+    limits.targetValue = std::max(1, delta.cold.bestValue);
+    delta.target = limits.targetValue;
+    delta.warm = warm.solve(limits);
+    return delta;
+}
+
+// Iterações e tempo até o alvo de uma execução, no formato do JSON (-1 se não chegou)
+// Número JSON, ou null quando o valor não foi medido (tempos por fase sem instrumentação)
+std::string measuredJson(bool measured, double value) {
+    if (!measured) {
+        return "null";
+    }
+    std::ostringstream out;
+    out << value;
+    return out.str();
+}
+
+std::string targetJson(const char* prefix, const SolveResult& result, int target) {
+    bool reached = (result.bestValue >= target);
+    std::ostringstream out;
+    out << "\"iteracoes_ate_alvo_" << prefix << "\":" << (reached ? result.bestIteration : -1)
+        << ",\"tempo_ate_alvo_" << prefix << "_s\":" << (reached ? result.bestTimeSeconds : -1.0)
+        << ",\"melhor_valor_" << prefix << "\":" << result.bestValue;
+    return out.str();
+}
+
+template <class Engine>
+ColonyRun runColony(const BenchmarkConfig& config, int capacity, const std::vector<Item>& items,
+                    const std::shared_ptr<const LocalSearch>& localSearch, const SolveLimits& limits,
+                    std::chrono::steady_clock::time_point start) {
+    Engine aco(config.numAnts, config.evaporationRate, config.alpha, config.beta, capacity, items,
+               config.maxIterations, config.seed, config.numThreads);
+    aco.setLocalSearch(localSearch, config.localSearchElites);
+    aco.setDuplicateCache(config.duplicateCache, config.uniqueDeposits);
+    std::tuple<std::vector<int>, int, int> result = aco.solve();
+    double totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Tempo até o alvo: a mesma seed refaz a mesma trajetória, agora parando no alvo
+    Engine targetAco(config.numAnts, config.evaporationRate, config.alpha, config.beta, capacity, items,
+                     config.maxIterations, config.seed, config.numThreads);
+    targetAco.setLocalSearch(localSearch, config.localSearchElites);
+    targetAco.setDuplicateCache(config.duplicateCache, config.uniqueDeposits);
+    SolveResult targetResult = targetAco.solve(limits);
+
+    DeltaRun delta;
+    if (config.deltaFraction > 0.0) {
+        delta = runDelta<Engine>(config, capacity, items, aco.checkpoint());
+    }
+    return {std::get<1>(result), totalSeconds, aco.getInstrumentation(), targetResult, delta};
+}
+
+ColonyRun runColony(const BenchmarkConfig& config, int capacity, const std::vector<Item>& items,
+                    const std::shared_ptr<const LocalSearch>& localSearch, const SolveLimits& limits,
+                    std::chrono::steady_clock::time_point start) {
+    switch (config.variant) {
+        case AcoVariant::AntSystem:    return runColony<AntSystemACO>(config, capacity, items, localSearch, limits, start);
+        case AcoVariant::Elitist:      return runColony<ElitistACO>(config, capacity, items, localSearch, limits, start);
+        case AcoVariant::RankBased:    return runColony<RankBasedACO>(config, capacity, items, localSearch, limits, start);
+        case AcoVariant::MaxMin:       return runColony<MaxMinACO>(config, capacity, items, localSearch, limits, start);
+        case AcoVariant::FastExponent: return runColony<FastExponentACO>(config, capacity, items, localSearch, limits, start);
+        case AcoVariant::Default:      break;
+    }
+    return runColony<ACO>(config, capacity, items, localSearch, limits, start);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchmarkConfig config;
+    if (!parseArguments(argc, argv, config)) {
+        return 1;
+    }
+
+    // Tamanhos em ordem crescente no laço externo: o pico de memória do processo
+    // reportado após cada caso reflete o maior tamanho executado até ali
+    std::sort(config.sizes.begin(), config.sizes.end());
+
+    for (int size : config.sizes) {
+        for (InstanceClass instanceClass : config.classes) {
+            std::pair<int, std::vector<Item>> instance = generateInstance(instanceClass, size, config.seed);
+            int capacity = instance.first;
+            const std::vector<Item>& items = instance.second;
+
+            // Com --reducao 1 o ACO trabalha no núcleo e os itens fixados dentro somam valueOffset
+            auto start = std::chrono::steady_clock::now();
+            ReducedInstance reduced = reduceInstance(capacity, items);
+            double reductionSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            double upperBound = reduced.upperBound;
+            double target = config.targetFraction * upperBound;
+            int acoCapacity = config.coreReduction ? reduced.capacity : capacity;
+            const std::vector<Item>& acoItems = config.coreReduction ? reduced.coreItems : items;
+            int valueOffset = config.coreReduction ? static_cast<int>(reduced.fixedValue) : 0;
+            if (!config.coreReduction) {
+                start = std::chrono::steady_clock::now();
+            }
+
+            std::shared_ptr<const LocalSearch> localSearch;
+            if (config.localSearchElites > 0) {
+                localSearch = std::make_shared<SwapLocalSearch>(acoCapacity, acoItems);
+            }
+
+            SolveLimits limits;
+            limits.targetValue = std::max(1, static_cast<int>(std::ceil(target)) - valueOffset);
+            ColonyRun colony = runColony(config, acoCapacity, acoItems, localSearch, limits, start);
+            int bestValue = colony.bestValue + valueOffset;
+            double totalSeconds = colony.totalSeconds;
+
+            // Os tempos por fase vêm dos ciclos da instrumentação; sem ela saem como null
+            const AcoInstrumentation& instrumentation = colony.instrumentation;
+            bool timed = instrumentation.hasPhaseTimes();
+            double constructionSeconds = instrumentation.phaseSeconds(AcoPhase::Construction);
+            double updateSeconds = instrumentation.phaseSeconds(AcoPhase::PheromoneUpdate);
+            const SolveResult& targetResult = colony.targetResult;
+            bool reachedTarget = (targetResult.stopReason == StopReason::TargetReached);
+            int iterationsToTarget = reachedTarget ? targetResult.bestIteration : -1;
+            double timeToTarget = reachedTarget ? targetResult.bestTimeSeconds : -1.0;
+
+            double antsBuilt = static_cast<double>(config.numAnts) * config.maxIterations;
+
+            // Mesmo orçamento total de formigas por iteração, dividido entre as ilhas
+            std::ostringstream islandJson;
+            if (config.islands.numIslands > 1) {
+                int antsPerIsland = std::max(1, config.numAnts / config.islands.numIslands);
+                IslandModel islandModel(antsPerIsland, config.evaporationRate, config.alpha, config.beta, acoCapacity,
+                                        acoItems, config.maxIterations, config.seed, config.islands);
+                IslandResult islandResult = islandModel.solve(limits);
+                bool islandsReached = islandResult.bestValue >= limits.targetValue;
+                islandJson << ",\"ilhas\":{\"ilhas\":" << config.islands.numIslands
+                           << ",\"formigas_por_ilha\":" << antsPerIsland
+                           << ",\"topologia\":\"" << migrationTopologyName(config.islands.topology) << "\""
+                           << ",\"migracao\":" << config.islands.migrationInterval
+                           << ",\"mistura\":" << config.islands.pheromoneBlend
+                           << ",\"melhor_valor\":" << islandResult.bestValue + valueOffset
+                           << ",\"tempo_ate_alvo_s\":" << (islandsReached ? islandResult.bestTimeSeconds : -1.0)
+                           << ",\"formigas_construidas\":" << islandResult.antsBuilt
+                           << ",\"migracoes\":" << islandResult.migrationsSent
+                           << ",\"migracoes_que_melhoraram\":" << islandResult.migrationsImproved
+                           << "}";
+            }
+
+            std::ostringstream deltaJson;
+            if (colony.delta.ran) {
+                deltaJson << ",\"delta\":{\"fracao\":" << config.deltaFraction
+                          << ",\"alvo\":" << colony.delta.target
+                          << "," << targetJson("frio", colony.delta.cold, colony.delta.target)
+                          << "," << targetJson("quente", colony.delta.warm, colony.delta.target) << "}";
+            }
+
+            // Referência exata sobre o núcleo (a redução preserva os ótimos)
+            ExactResult exact = solveExact(reduced.capacity, reduced.coreItems, 0, config.exactTimeLimitSeconds);
+            long long optimumValue = exact.value + reduced.fixedValue;
+
+            std::cout << "{\"classe\":\"" << instanceClassName(instanceClass) << "\""
+                      << ",\"itens\":" << size
+                      << ",\"capacidade\":" << capacity
+                      << ",\"formigas\":" << config.numAnts
+                      << ",\"iteracoes\":" << config.maxIterations
+                      << ",\"threads\":" << config.numThreads
+                      << ",\"seed\":" << config.seed
+                      << ",\"variante\":\"" << acoVariantName(config.variant) << "\""
+                      << ",\"tempo_total_s\":" << totalSeconds
+                      << ",\"formigas_por_s\":" << measuredJson(constructionSeconds > 0.0, antsBuilt / constructionSeconds)
+                      << ",\"tempo_construcao_s\":" << measuredJson(timed, constructionSeconds)
+                      << ",\"tempo_atualizacao_s\":" << measuredJson(timed, updateSeconds)
+                      << ",\"busca_local_formigas\":" << config.localSearchElites
+                      << ",\"tempo_busca_local_s\":"
+                      << measuredJson(timed, instrumentation.phaseSeconds(AcoPhase::LocalSearch))
+                      << ",\"repetidas\":\"" << duplicateCacheModeName(config.duplicateCache) << "\""
+                      << ",\"deposito_unico\":" << (config.uniqueDeposits ? 1 : 0)
+                      << ",\"taxa_repetidas\":"
+                      << instrumentation.duplicateHitRate(static_cast<std::uint64_t>(antsBuilt))
+                      << ",\"atualizacao_ms_por_iteracao\":"
+                      << measuredJson(timed, 1000.0 * updateSeconds / config.maxIterations)
+                      << ",\"reducao\":" << (config.coreReduction ? 1 : 0)
+                      << ",\"itens_nucleo\":" << reduced.coreItems.size()
+                      << ",\"itens_fixados_dentro\":" << reduced.fixedIn.size()
+                      << ",\"itens_fixados_fora\":" << reduced.numFixedOut
+                      << ",\"tempo_reducao_s\":" << reductionSeconds
+                      << ",\"melhor_valor\":" << bestValue
+                      << ",\"limite_superior\":" << upperBound
+                      << ",\"limite_inferior_guloso\":" << reduced.lowerBound
+                      << ",\"gap\":" << optimalityGap(bestValue, upperBound)
+                      << ",\"otimo\":" << optimumValue
+                      << ",\"otimo_provado\":" << (exact.optimal ? "true" : "false")
+                      << ",\"metodo_exato\":\"" << exactMethodName(exact.method) << "\""
+                      << ",\"tempo_exato_s\":" << exact.seconds
+                      << ",\"gap_otimo\":" << static_cast<double>(optimumValue - bestValue) / std::max(1LL, optimumValue)
+                      << ",\"alvo\":" << target
+                      << ",\"iteracoes_ate_alvo\":" << iterationsToTarget
+                      << ",\"tempo_ate_alvo_s\":" << timeToTarget
+                      << ",\"formigas_ate_alvo\":"
+                      << (reachedTarget ? static_cast<long long>(targetResult.iterations) * config.numAnts : -1LL)
+                      << ",\"memoria_pico_kb\":" << peakMemoryKb()
+                      << ",\"instrumentacao\":" << instrumentation.toJson()
+                      << islandJson.str()
+                      << deltaJson.str()
+                      << "}" << std::endl;
+        }
+    }
+
+    return 0;
+}
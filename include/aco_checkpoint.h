@@ -0,0 +1,40 @@
+#ifndef ACO_CHECKPOINT_H
+#define ACO_CHECKPOINT_H
+
+#include <vector>   // Para std::vector
+#include <string>   // Para std::string
+#include <cstdint>  // Para std::uint64_t, std::int64_t
+
+// Retrato do estado de um ACO ao fim de solve(), usado para recomeçar ("warm start") numa
+// versão alterada da mesma instância. Tudo é indexado por Item::id, não pela posição do item,
+// para sobreviver a itens adicionados, removidos ou reordenados.
+struct AcoCheckpoint {
+    int capacity = 0;
+    unsigned int seed = 0;
+    std::uint64_t iterations = 0;   // Iterações já feitas: o fluxo aleatório continua a partir daqui
+    long long bestValue = 0;        // Valor da melhor solução na instância original
+    std::vector<int> itemIds;       // Item::id de cada posição de take/notTake
+    std::vector<double> take;       // Feromônio de incluir o item
+    std::vector<double> notTake;    // Feromônio de não incluir
+    std::vector<int> bestItemIds;   // Item::id dos itens da melhor solução
+};
+
+// Formato binário: cabeçalho fixo seguido dos vetores, na ordem da struct
+struct CheckpointHeader {
+    char magic[8];              // "ACOCKPT1"
+    std::uint32_t version;      // 1
+    std::uint32_t seed;
+    std::uint64_t numItems;
+    std::uint64_t numBestItems;
+    std::uint64_t iterations;
+    std::int64_t capacity;
+    std::int64_t bestValue;
+};
+
+static_assert(sizeof(CheckpointHeader) == 56, "cabeçalho do checkpoint com layout fixo");
+
+// Em caso de falha preenchem error e retornam false
+bool writeCheckpoint(const std::string& filePath, const AcoCheckpoint& checkpoint, std::string& error);
+bool readCheckpoint(const std::string& filePath, AcoCheckpoint& checkpoint, std::string& error);
+
+#endif // ACO_CHECKPOINT_H
@@ -0,0 +1,324 @@
+#ifndef ACO_ENGINE_H
+#define ACO_ENGINE_H
+
+#include <vector>    // Para std::vector
+#include <utility>   // Para std::pair
+#include <tuple>     // Para std::tuple
+#include <memory>    // Para std::unique_ptr
+#include <functional> // Para std::function
+#include <cstddef>   // Para std::size_t
+#include <atomic>    // Para std::atomic (incumbente consultável durante a execução)
+#include <mutex>     // Para std::mutex
+#include <type_traits> // Para std::is_integral
+
+#include "utils.h"   // Assumindo que struct Item está definido aqui
+#include "solution.h" // Para Solution (um bit por item, com valor e peso acumulados)
+#include "rng.h"     // Para Xoshiro256x4 (um fluxo aleatório por formiga)
+#include "thread_pool.h"
+#include "aligned_allocator.h"
+#include "pheromone_kernels.h"
+#include "instrumentation.h"
+#include "local_search.h"
+#include "fingerprint_set.h"
+#include "aco_checkpoint.h"
+#include "trace_writer.h"
+#include "aco_policies.h"
+
+// Motivo pelo qual solve() parou
+enum class StopReason {
+    MaxIterations,   // Executou todas as iterações configuradas
+    TimeBudget,      // Estourou o orçamento de tempo
+    TargetReached,   // Atingiu o valor-alvo
+    Stagnation,      // Ficou a janela inteira sem melhorar
+    Interrupted      // O gancho de iteração pediu para parar (por exemplo, outra ilha atingiu o alvo)
+};
+
+const char* stopReasonName(StopReason reason);
+
+// Limites do modo "anytime". Valores <= 0 desligam o respectivo critério.
+struct SolveLimits {
+    double timeBudgetSeconds = 0.0;  // Orçamento de tempo de relógio
+    int targetValue = 0;             // Para assim que encontrar uma solução com valor >= alvo
+    int stagnationWindow = 0;        // Para após N iterações seguidas sem melhora
+};
+
+// Resultado completo de uma execução com limites
+struct SolveResult {
+    std::vector<int> solution;
+    int bestValue;
+    int worstValue;
+    StopReason stopReason;
+    int iterations;          // Iterações concluídas
+    int bestIteration;       // Iteração (1..iterations) em que o melhor valor foi encontrado; 0 se nenhum
+    double bestTimeSeconds;  // Tempo desde o início de solve() até encontrar o melhor valor
+    double elapsedSeconds;   // Tempo total de solve()
+};
+
+// Cópia da melhor solução conhecida, obtida com segurança por outra thread durante solve()
+struct Incumbent {
+    int value;
+    std::vector<int> solution;
+    int iteration;
+    double seconds;
+};
+
+// Motor do ACO para a mochila 0/1, especializado em tempo de compilação por políticas
+// (ver aco_policies.h):
+//   UpdateRule: regra de atualização do feromônio (TopRankUpdate, AntSystemUpdate,
+//               ElitistUpdate, RankBasedUpdate, MaxMinUpdate)
+//   Heuristic:  visibilidade de cada item (RatioHeuristic, ValueHeuristic)
+//   WeightT:    largura inteira dos valores e pesos guardados para a construção (int16_t,
+//               int32_t, int64_t); precisa comportar capacidade + maior peso
+//   AlphaExp, BetaExp: tau^alpha e eta^beta (RuntimeExponent, IntegerExponent<N>,
+//               HalfIntegerExponent<N>)
+// Nenhuma política usa despacho virtual. A classe ACO (aco.h) é uma instanciação deste
+// motor; outras variantes comuns estão em aco_variants.h, e qualquer combinação pode ser
+// instanciada incluindo aco_engine_impl.h.
+template <class UpdateRule, class Heuristic, class WeightT, class AlphaExp, class BetaExp>
+class ACOEngine {
+    static_assert(std::is_integral<WeightT>::value && std::is_signed<WeightT>::value,
+                  "WeightT deve ser um inteiro com sinal");
+
+public:
+    // Construtor
+    // numThreads: threads usadas na construção das formigas (1 = serial). O resultado para
+    // uma mesma seed é idêntico qualquer que seja o número de threads.
+    // Com expoentes de compilação, alpha e beta precisam coincidir com os da política.
+    ACOEngine(int numAnts, double evaporationRate, double alpha, double beta,
+              int capacity, const std::vector<Item>& items, int maxIterations, unsigned int seed,
+              int numThreads = 1);
+
+    // Recomeço ("warm start") a partir do checkpoint de uma execução anterior sobre uma versão
+    // alterada da instância. O feromônio dos itens que continuam (mesmo Item::id) é copiado; item
+    // novo recebe o feromônio do item sobrevivente de heurística mais próxima. A melhor solução
+    // antiga, reparada para caber na nova capacidade, é o ponto de partida de cada solve().
+    // A seed e o fluxo aleatório continuam os do checkpoint. O feromônio de uma colônia que já
+    // convergiu praticamente não deixa explorar; smoothing puxa cada entrada essa fração do
+    // caminho até a média (0 mantém o feromônio como estava, 1 esquece o que foi aprendido).
+    ACOEngine(int numAnts, double evaporationRate, double alpha, double beta,
+              int capacity, const std::vector<Item>& items, int maxIterations, const AcoCheckpoint& warmStart,
+              int numThreads = 1, double smoothing = 0.9);
+
+    // Reaproveita este objeto (threads e áreas de trabalho) para outra instância ou outros
+    // parâmetros: equivale a construir de novo com o mesmo numThreads, mas sem realocar o que já
+    // tem tamanho suficiente. Desliga a busca local e o warm start; o cache de repetidas fica.
+    void reset(int numAnts, double evaporationRate, double alpha, double beta,
+               int capacity, const std::vector<Item>& items, int maxIterations, unsigned int seed);
+
+    ACOEngine(const ACOEngine&) = delete;
+    ACOEngine& operator=(const ACOEngine&) = delete;
+
+    // Método principal para resolver o problema da mochila
+    std::tuple<std::vector<int>, int, int> solve();
+
+    // Modo "anytime": roda até maxIterations ou até o primeiro limite atingido
+    // (tempo, valor-alvo ou estagnação) e devolve a melhor solução até ali
+    SolveResult solve(const SolveLimits& limits);
+
+    // Consulta do incumbente, segura para chamar de outra thread enquanto solve() roda.
+    // getIncumbentValue() é só uma leitura atômica; getIncumbent() copia a solução sob um mutex.
+    int getIncumbentValue() const;
+    Incumbent getIncumbent() const;
+
+    // Gancho chamado pela thread de solve() ao fim de cada iteração, já com o feromônio
+    // atualizado e antes dos critérios de parada. Recebe o número de iterações concluídas;
+    // devolver false encerra solve() com StopReason::Interrupted. Usado pelo modelo de ilhas.
+    void setIterationHook(std::function<bool(int)> hook);
+
+    // Recebe uma solução vinda de fora (migração). Se for viável, reforça seu rastro de
+    // feromônio como um depósito elitista e, se for melhor, passa a ser a melhor da colônia.
+    // Devolve true se a melhor solução mudou. Só pode ser chamado dentro do gancho de iteração.
+    bool injectSolution(const Solution& solution);
+
+    // Mistura o feromônio com o de outra colônia: tau = (1 - weight) * tau + weight * outro.
+    // Mesma restrição de injectSolution: só dentro do gancho de iteração.
+    void blendPheromones(const AlignedDoubleVector& take, const AlignedDoubleVector& notTake, double weight);
+
+    // Liga um estágio de busca local aplicado às eliteCount melhores formigas de cada iteração,
+    // depois da construção e antes da avaliação e do depósito de feromônio. A busca precisa ter
+    // sido criada para a mesma instância (itens e capacidade) deste ACO. nullptr desliga.
+    void setLocalSearch(std::shared_ptr<const LocalSearch> localSearch, int eliteCount);
+
+    // Liga o traço de convergência: ao fim de cada iteração, solve() entrega a writer um
+    // TraceRecord com o identificador run (melhor, média e pior formiga da iteração, entropia do
+    // feromônio a cada kTraceEntropyInterval iterações e tempo). valueOffset é somado aos
+    // valores gravados (por exemplo, o valor dos itens fixados pela redução ao núcleo).
+    // nullptr desliga; o writer precisa ficar aberto durante solve().
+    void setTrace(TraceWriter* writer, std::uint32_t run, int valueOffset = 0);
+
+    // Cache de soluções repetidas, pela impressão digital mantida na Solution. Desligado por
+    // padrão: avaliar uma formiga custa pouco, e o cache só se paga quando a colônia converge e a
+    // busca local é cara. PerIteration não muda o resultado: formigas repetidas na iteração não
+    // são reavaliadas e, entre as elites, só uma cópia passa pela busca local (as outras recebem
+    // o resultado). CrossIteration também pula a avaliação de soluções vistas em iterações
+    // anteriores, guardadas num arquivo de até kSeenSolutionBytes. Nos dois modos um acerto só
+    // vale depois de comparar os bits, então colisões de 64 bits não descartam soluções. Com
+    // uniqueDeposits, cada solução distinta deposita feromônio no máximo uma vez por iteração
+    // (muda a trajetória).
+    void setDuplicateCache(DuplicateCacheMode mode, bool uniqueDeposits = false);
+
+    // Estado corrente da colônia, lido pela própria thread de solve() (no gancho de iteração)
+    const Solution& getBestSolution() const;
+    const AlignedDoubleVector& getPheromoneTake() const;
+    const AlignedDoubleVector& getPheromoneNotTake() const;
+
+    // Retrato do estado atual (feromônio, melhor solução e posição do fluxo aleatório),
+    // para gravar com writeCheckpoint e recomeçar depois com o construtor de warm start
+    AcoCheckpoint checkpoint() const;
+
+    // Getter para o histórico do melhor valor por iteração
+    const std::vector<int>& getBestValueHistory() const;
+
+    // Getter para a instrumentação da última execução (ciclos por fase e contadores)
+    const AcoInstrumentation& getInstrumentation() const;
+
+    // Gancho de teste: alocações no heap feitas dentro do laço de iterações da última
+    // chamada a solve(). Só é medido com -DACO_COUNT_ALLOCATIONS (ver alloc_counter.h);
+    // nesse modo solve() também verifica com assert que o valor é zero.
+    std::size_t getIterationAllocations() const;
+
+private:
+    // Parâmetros do algoritmo
+    int numAnts_;
+    double evaporationRate_;
+    double alpha_;
+    double beta_;
+    int capacity_;
+    std::vector<Item> items_;
+    int maxIterations_;
+
+    // Estruturas de dados internas
+    // Matriz de feromônios guardada como dois vetores contíguos e alinhados:
+    // pheromoneTake_[item_idx]    = feromônio para PEGAR o item
+    // pheromoneNotTake_[item_idx] = feromônio para NÃO PEGAR o item
+    AlignedDoubleVector pheromoneTake_;
+    AlignedDoubleVector pheromoneNotTake_;
+
+    // Kernels de evaporação/depósito escolhidos em tempo de execução (AVX-512, AVX2, SSE2 ou escalar)
+    const PheromoneKernels* kernels_;
+
+    // Políticas instanciadas (a regra de atualização pode ter estado, como no MAX-MIN)
+    UpdateRule updateRule_;
+    AlphaExp alphaPower_;
+    BetaExp betaPower_;
+
+    // Valores e pesos na largura escolhida, lidos no laço de construção
+    WeightT capacityT_;
+    std::vector<WeightT> values_;
+    std::vector<WeightT> weights_;
+
+    // Cache de atratividade, para que a construção não chame std::pow
+    // heuristicPowBeta_[i] = eta_i^beta (fixo para a instância, calculado no construtor)
+    // attractivenessTake_[i] = tau_i1^alpha * eta_i^beta, attractivenessNotTake_[i] = tau_i0^alpha
+    // (recalculados uma vez por item após cada atualização de feromônio)
+    std::vector<double> heuristicPowBeta_;
+    std::vector<double> attractivenessTake_;
+    std::vector<double> attractivenessNotTake_;
+
+    // Ordem fixa dos itens por razão valor/peso (decrescente), calculada uma vez por instância,
+    // e o menor peso a partir de cada posição dessa ordem (para encerrar cedo o preenchimento guloso)
+    std::vector<int> ratioOrder_;
+    std::vector<WeightT> minWeightFromRank_;
+    std::vector<double> ratioScratch_;  // Razões usadas só na ordenação (guardadas para reset())
+
+    // Semente base: cada formiga de cada iteração recebe seu próprio fluxo derivado dela.
+    // iterationOffset_ desloca o contador de iterações (não zero só no warm start).
+    unsigned int seed_;
+    std::uint64_t iterationOffset_;
+
+    // Pool persistente que constrói as formigas em paralelo
+    std::unique_ptr<ThreadPool> pool_;
+
+    // Números aleatórios são sorteados em blocos deste tamanho (cabem no L1 junto com o resto)
+    static constexpr std::size_t kRandomBlock = 256;
+
+    // Rascunho da construção, um por thread do pool, dimensionado no construtor
+    struct AntScratch {
+        std::vector<int> itemIndices;
+        std::uint64_t randomWords[kRandomBlock];  // Palavras brutas para o embaralhamento
+        double uniforms[kRandomBlock];            // Uniformes em [0, 1) para a decisão de cada item
+        std::size_t allocations;  // Alocações observadas nesta thread (gancho de teste)
+        AcoInstrumentation instrumentation;  // Contadores desta thread, somados ao fim de solve()
+        LocalSearchScratch localSearch;
+    };
+
+    // Áreas reaproveitadas durante toda a execução: o laço de iterações não aloca memória
+    std::vector<AntScratch> scratch_;
+    std::vector<Solution> antSolutions_;  // Uma solução por formiga, sobrescrita a cada iteração
+    std::vector<int> rankedAnts_;         // Índices das formigas viáveis, ordenados para o depósito
+    int currentIteration_;
+    std::function<void(int, int)> constructTask_;  // Criada uma vez para não alocar a cada iteração
+    std::size_t iterationAllocations_;
+    std::function<bool(int)> iterationHook_;
+
+    // Busca local opcional sobre as melhores formigas da iteração
+    std::shared_ptr<const LocalSearch> localSearch_;
+    std::vector<int> eliteAnts_;
+    int eliteCount_;
+    std::function<void(int, int)> localSearchTask_;
+
+    // Cache de soluções repetidas
+    static constexpr std::size_t kSeenFingerprints = 1 << 16;  // Entradas do modo CrossIteration
+    static constexpr std::size_t kSeenSolutionBytes = 64 << 20;  // Limite do arquivo de soluções vistas
+    DuplicateCacheMode duplicateMode_;
+    bool uniqueDeposits_;
+    FingerprintSet iterationFingerprints_;
+    FingerprintSet seenFingerprints_;                    // Rótulo = posição da solução em seenWords_
+    std::vector<std::uint64_t> seenWords_;               // Bits das soluções vistas, seenSlots_ posições
+    std::size_t seenSlots_;
+    std::vector<char> duplicateAnt_;                     // 1 se a formiga repete outra da iteração
+    std::vector<std::pair<int, int>> duplicateElites_;   // (elite repetida, elite de origem)
+
+    // Solução inicial do warm start (vazia, com size() == 0, quando não há checkpoint)
+    Solution warmStartSolution_;
+
+    // Melhor solução encontrada por esta instância do ACO
+    int bestValueGlobal_;
+    Solution bestSolutionGlobal_;
+
+    // Incumbente publicado para outras threads (atualizado só quando o melhor valor muda)
+    std::atomic<int> incumbentValue_;
+    mutable std::mutex incumbentMutex_;
+    Solution incumbentSolution_;
+    int incumbentIteration_;
+    double incumbentSeconds_;
+
+    // Histórico de convergência e traço opcional por iteração
+    std::vector<int> bestValuePerIteration_;
+    TraceWriter* traceWriter_;
+    std::uint32_t traceRun_;
+    int traceValueOffset_;
+    AcoInstrumentation instrumentation_;
+
+    // Métodos auxiliares
+    void prepareInstance();
+    void initializePheromones();
+    void initializeHeuristicCache();
+    void initializeRatioOrder();
+    void applyWarmStart(const AcoCheckpoint& checkpoint, double smoothing);
+    void publishIncumbent(int iteration, double seconds);
+    void updateAttractiveness();
+    PheromoneState pheromoneState();
+
+    // Constrói uma solução para uma formiga, adicionando itens até a mochila estar cheia ou não caber mais nada
+    // Só lê o estado compartilhado, podendo rodar em paralelo para formigas diferentes;
+    // grava o resultado em out e usa scratch como área de trabalho
+    void constructSolution(Xoshiro256x4& rng, Solution& out, AntScratch& scratch) const;
+
+    // Calcula a probabilidade de escolher um item dado seu estado (pegar ou não pegar)
+    double calculateProbability(int itemIndex, int option, WeightT currentWeight) const; // option: 0=not_take, 1=take
+
+    // Atualiza os níveis de feromônio após cada iteração
+    void updatePheromones(const std::vector<Solution>& solutions);
+
+    // Verifica a capacidade usando o peso acumulado na própria solução
+    bool isFeasible(const Solution& solution) const;
+
+    // Modo CrossIteration: registra a solução no arquivo e diz se ela, bit a bit, já estava lá
+    bool isSeenBefore(const Solution& solution);
+
+    // Função heurística (visibilidade) para um item, dada pela política Heuristic
+    double getHeuristicInformation(int itemIndex) const;
+};
+
+#endif // ACO_ENGINE_H
@@ -0,0 +1,794 @@
+#ifndef ACO_ENGINE_IMPL_H
+#define ACO_ENGINE_IMPL_H
+
+// Definições do ACOEngine. Só precisa ser incluído por quem instancia uma combinação nova
+// de políticas; as variantes de aco.h e aco_variants.h já vêm instanciadas.
+
+#include "aco_engine.h"
+#include <algorithm> // std::max_element, std::min_element, std::partial_sort
+#include <numeric>   // std::iota
+#include <cmath>     // std::pow
+#include <iostream>  // std::cout, std::endl (opcional)
+#include <climits> // Para INT_MAX
+#include <cassert>  // Para assert (gancho de alocações)
+#include <chrono>   // Para std::chrono::steady_clock
+#include <limits>   // Para std::numeric_limits
+#include <unordered_map> // Para o mapa Item::id -> posição do warm start
+
+#include "alloc_counter.h"
+
+#define ACO_ENGINE_TEMPLATE template <class UpdateRule, class Heuristic, class WeightT, class AlphaExp, class BetaExp>
+#define ACO_ENGINE ACOEngine<UpdateRule, Heuristic, WeightT, AlphaExp, BetaExp>
+
+ACO_ENGINE_TEMPLATE
+ACO_ENGINE::ACOEngine(int numAnts, double evaporationRate, double alpha, double beta,
+                      int capacity, const std::vector<Item>& items, int maxIterations, unsigned int seed,
+                      int numThreads)
+    : numAnts_(numAnts), evaporationRate_(evaporationRate), alpha_(alpha), beta_(beta),
+      capacity_(capacity), items_(items), maxIterations_(maxIterations),
+      kernels_(&selectPheromoneKernels()), alphaPower_(alpha), betaPower_(beta),
+      capacityT_(static_cast<WeightT>(capacity)), seed_(seed), iterationOffset_(0), pool_(new ThreadPool(std::max(numThreads, 1))),
+      currentIteration_(0), iterationAllocations_(0), eliteCount_(0),
+      duplicateMode_(DuplicateCacheMode::Off), uniqueDeposits_(false), seenSlots_(0), bestValueGlobal_(0),
+      incumbentValue_(0), incumbentIteration_(0), incumbentSeconds_(0.0),
+      traceWriter_(nullptr), traceRun_(0), traceValueOffset_(0) {
+    prepareInstance();
+
+    // Cada formiga usa um fluxo derivado de (seed_, iteração, formiga)
+    constructTask_ = [this](int ant, int worker) {
+        AntScratch& scratch = scratch_[worker];
+        std::size_t allocationsBefore = allocationCount();
+        Xoshiro256x4 antRng = Xoshiro256x4::forStream(seed_, iterationOffset_ + static_cast<std::uint64_t>(currentIteration_),
+                                                      static_cast<std::uint64_t>(ant));
+        constructSolution(antRng, antSolutions_[ant], scratch);
+        scratch.allocations += allocationCount() - allocationsBefore;
+    };
+
+    localSearchTask_ = [this](int rank, int worker) {
+        AntScratch& scratch = scratch_[worker];
+        std::size_t allocationsBefore = allocationCount();
+        Solution& solution = antSolutions_[eliteAnts_[rank]];
+        int moves = localSearch_->improve(solution, scratch.localSearch);
+        ACO_INSTR(scratch.instrumentation.localSearchMoves += moves;)
+        ACO_INSTR(scratch.instrumentation.localSearchImproved += (moves > 0) ? 1 : 0;)
+        (void)moves;
+        scratch.allocations += allocationCount() - allocationsBefore;
+    };
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::prepareInstance() {
+    if (!AlphaExp::accepts(alpha_) || !BetaExp::accepts(beta_)) {
+        std::cerr << "Aviso: alpha=" << alpha_ << " e beta=" << beta_
+                  << " diferem dos expoentes fixados na variante do ACO; valem os da variante." << std::endl;
+    }
+
+    // Valores e pesos na largura WeightT; a soma capacidade + peso precisa caber nela
+    long long maxWeight = 0;
+    values_.resize(items_.size());
+    weights_.resize(items_.size());
+    for (size_t i = 0; i < items_.size(); ++i) {
+        values_[i] = static_cast<WeightT>(items_[i].value);
+        weights_[i] = static_cast<WeightT>(items_[i].weight);
+        maxWeight = std::max<long long>(maxWeight, items_[i].weight);
+    }
+    if (static_cast<long long>(capacity_) + maxWeight > static_cast<long long>(std::numeric_limits<WeightT>::max())) {
+        std::cerr << "Aviso: capacidade + maior peso (" << static_cast<long long>(capacity_) + maxWeight
+                  << ") não cabe na largura inteira escolhida para o ACO." << std::endl;
+    }
+
+    initializeHeuristicCache();
+    initializeRatioOrder();
+    initializePheromones();
+
+    // Todas as áreas de trabalho são dimensionadas aqui, uma única vez por instância;
+    // assign/resize reaproveitam a memória quando a instância nova não é maior que a anterior
+    const size_t n = items_.size();
+    scratch_.resize(pool_->size());
+    for (AntScratch& scratch : scratch_) {
+        scratch.itemIndices.reserve(n);
+        scratch.allocations = 0;
+    }
+    antSolutions_.resize(numAnts_);
+    for (Solution& solution : antSolutions_) {
+        solution.reset(n);
+    }
+    rankedAnts_.reserve(numAnts_);
+    eliteAnts_.reserve(numAnts_);
+    iterationFingerprints_.reserve(numAnts_);
+    duplicateAnt_.assign(numAnts_, 0);
+    duplicateElites_.reserve(numAnts_);
+    bestSolutionGlobal_.reset(n);
+    incumbentSolution_.reset(n);
+    bestValuePerIteration_.reserve(maxIterations_);
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::reset(int numAnts, double evaporationRate, double alpha, double beta,
+                       int capacity, const std::vector<Item>& items, int maxIterations, unsigned int seed) {
+    numAnts_ = numAnts;
+    evaporationRate_ = evaporationRate;
+    alpha_ = alpha;
+    beta_ = beta;
+    capacity_ = capacity;
+    items_.assign(items.begin(), items.end());
+    maxIterations_ = maxIterations;
+    alphaPower_ = AlphaExp(alpha);
+    betaPower_ = BetaExp(beta);
+    capacityT_ = static_cast<WeightT>(capacity);
+    seed_ = seed;
+    iterationOffset_ = 0;
+    updateRule_ = UpdateRule();
+    warmStartSolution_.reset(0);
+    setLocalSearch(nullptr, 0);
+    prepareInstance();
+}
+
+ACO_ENGINE_TEMPLATE
+ACO_ENGINE::ACOEngine(int numAnts, double evaporationRate, double alpha, double beta,
+                      int capacity, const std::vector<Item>& items, int maxIterations, const AcoCheckpoint& warmStart,
+                      int numThreads, double smoothing)
+    : ACOEngine(numAnts, evaporationRate, alpha, beta, capacity, items, maxIterations, warmStart.seed, numThreads) {
+    applyWarmStart(warmStart, smoothing);
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::applyWarmStart(const AcoCheckpoint& checkpoint, double smoothing) {
+    if (checkpoint.take.size() != checkpoint.itemIds.size() || checkpoint.notTake.size() != checkpoint.itemIds.size()) {
+        std::cerr << "Aviso: checkpoint inconsistente; o ACO começa do zero." << std::endl;
+        return;
+    }
+    iterationOffset_ = checkpoint.iterations;
+
+    const size_t n = items_.size();
+    std::unordered_map<int, size_t> checkpointPosition;
+    checkpointPosition.reserve(checkpoint.itemIds.size());
+    for (size_t j = 0; j < checkpoint.itemIds.size(); ++j) {
+        checkpointPosition[checkpoint.itemIds[j]] = j;
+    }
+
+    // Itens que sobreviveram herdam o próprio feromônio; os demais ficam para depois
+    std::vector<std::pair<double, size_t>> survivors;  // (heurística na instância nova, posição no checkpoint)
+    std::vector<size_t> newItems;
+    std::unordered_map<int, size_t> itemPosition;
+    itemPosition.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        itemPosition[items_[i].id] = i;
+        auto found = checkpointPosition.find(items_[i].id);
+        if (found == checkpointPosition.end()) {
+            newItems.push_back(i);
+            continue;
+        }
+        pheromoneTake_[i] = checkpoint.take[found->second];
+        pheromoneNotTake_[i] = checkpoint.notTake[found->second];
+        survivors.emplace_back(getHeuristicInformation((int)i), found->second);
+    }
+
+    // Item novo: copia o feromônio do sobrevivente com a razão valor/peso mais próxima, que
+    // a colônia já aprendeu a tratar; sem sobreviventes fica o valor inicial
+    std::sort(survivors.begin(), survivors.end());
+    for (size_t i : newItems) {
+        if (survivors.empty()) {
+            break;
+        }
+        double eta = getHeuristicInformation((int)i);
+        auto next = std::lower_bound(survivors.begin(), survivors.end(), std::make_pair(eta, size_t(0)));
+        if (next == survivors.end() || (next != survivors.begin() && eta - std::prev(next)->first < next->first - eta)) {
+            --next;
+        }
+        pheromoneTake_[i] = checkpoint.take[next->second];
+        pheromoneNotTake_[i] = checkpoint.notTake[next->second];
+    }
+
+    // Suavização em direção à média das duas opções
+    smoothing = std::min(std::max(smoothing, 0.0), 1.0);
+    if (smoothing > 0.0 && n > 0) {
+        double mean = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            mean += pheromoneTake_[i] + pheromoneNotTake_[i];
+        }
+        mean /= 2.0 * n;
+        for (size_t i = 0; i < n; ++i) {
+            pheromoneTake_[i] += smoothing * (mean - pheromoneTake_[i]);
+            pheromoneNotTake_[i] += smoothing * (mean - pheromoneNotTake_[i]);
+        }
+    }
+    updateAttractiveness();
+
+    // Melhor solução antiga, restrita aos itens que ainda existem: tira os de pior razão
+    // até caber na capacidade nova e completa gulosamente
+    warmStartSolution_.reset(n);
+    for (int id : checkpoint.bestItemIds) {
+        auto found = itemPosition.find(id);
+        if (found != itemPosition.end() && !warmStartSolution_.test(found->second)) {
+            warmStartSolution_.add(found->second, values_[found->second], weights_[found->second]);
+        }
+    }
+    for (size_t k = n; k-- > 0 && !isFeasible(warmStartSolution_);) {
+        int itemIdx = ratioOrder_[k];
+        if (warmStartSolution_.test(itemIdx)) {
+            warmStartSolution_.remove(itemIdx, values_[itemIdx], weights_[itemIdx]);
+        }
+    }
+    for (size_t k = 0; k < n; ++k) {
+        int itemIdx = ratioOrder_[k];
+        if (!warmStartSolution_.test(itemIdx) && warmStartSolution_.weight() + weights_[itemIdx] <= capacity_) {
+            warmStartSolution_.add(itemIdx, values_[itemIdx], weights_[itemIdx]);
+        }
+    }
+}
+
+ACO_ENGINE_TEMPLATE
+AcoCheckpoint ACO_ENGINE::checkpoint() const {
+    AcoCheckpoint result;
+    result.capacity = capacity_;
+    result.seed = seed_;
+    result.iterations = iterationOffset_ + bestValuePerIteration_.size();
+    result.bestValue = bestValueGlobal_;
+    result.itemIds.resize(items_.size());
+    for (size_t i = 0; i < items_.size(); ++i) {
+        result.itemIds[i] = items_[i].id;
+    }
+    result.take.assign(pheromoneTake_.begin(), pheromoneTake_.end());
+    result.notTake.assign(pheromoneNotTake_.begin(), pheromoneNotTake_.end());
+    bestSolutionGlobal_.forEachSetBit([&](std::size_t i) { result.bestItemIds.push_back(items_[i].id); });
+    return result;
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::initializePheromones() {
+    pheromoneTake_.assign(items_.size(), 0.1);
+    pheromoneNotTake_.assign(items_.size(), 0.1);
+    updateAttractiveness();
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::initializeHeuristicCache() {
+    heuristicPowBeta_.resize(items_.size());
+    for (size_t i = 0; i < items_.size(); ++i) {
+        heuristicPowBeta_[i] = betaPower_(getHeuristicInformation((int)i));
+    }
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::initializeRatioOrder() {
+    const size_t n = items_.size();
+    std::vector<double>& ratio = ratioScratch_;
+    ratio.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        // Peso zero daria inf ou NaN (0/0), e NaN quebra a ordem estrita do std::sort; esses itens
+        // ficam com a chave do valor e são separados pelo comparador abaixo
+        ratio[i] = (items_[i].weight == 0) ? static_cast<double>(items_[i].value)
+                                           : static_cast<double>(items_[i].value) / items_[i].weight;
+    }
+
+    // Itens de peso zero primeiro (sempre cabem), por valor decrescente; depois a maior razão.
+    // No empate, maior índice primeiro (mesma ordem da antiga ordenação decrescente de pares
+    // (razão, índice) feita por formiga)
+    ratioOrder_.resize(n);
+    std::iota(ratioOrder_.begin(), ratioOrder_.end(), 0);
+    std::sort(ratioOrder_.begin(), ratioOrder_.end(), [this, &ratio](int a, int b) {
+        bool freeA = (items_[a].weight == 0);
+        bool freeB = (items_[b].weight == 0);
+        if (freeA != freeB) {
+            return freeA;
+        }
+        return (ratio[a] != ratio[b]) ? ratio[a] > ratio[b] : a > b;
+    });
+
+    minWeightFromRank_.resize(n);
+    WeightT minWeight = std::numeric_limits<WeightT>::max();
+    for (size_t k = n; k-- > 0;) {
+        minWeight = std::min(minWeight, weights_[ratioOrder_[k]]);
+        minWeightFromRank_[k] = minWeight;
+    }
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::updateAttractiveness() {
+    attractivenessTake_.resize(items_.size());
+    attractivenessNotTake_.resize(items_.size());
+    for (size_t i = 0; i < items_.size(); ++i) {
+        attractivenessTake_[i] = alphaPower_(pheromoneTake_[i]) * heuristicPowBeta_[i];
+        attractivenessNotTake_[i] = alphaPower_(pheromoneNotTake_[i]);
+    }
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::constructSolution(Xoshiro256x4& rng, Solution& currentSolution, AntScratch& scratch) const {
+    const size_t numItems = items_.size();
+    currentSolution.reset(numItems);
+
+    // Fisher-Yates com as palavras sorteadas em blocos e o índice limitado pelo método de Lemire
+    std::vector<int>& itemIndices = scratch.itemIndices;
+    itemIndices.resize(numItems);
+    std::iota(itemIndices.begin(), itemIndices.end(), 0);
+    for (size_t i = numItems; i > 1;) {
+        size_t count = std::min(kRandomBlock, i - 1);
+        rng.fill(scratch.randomWords, count);
+        for (size_t k = 0; k < count; ++k, --i) {
+            std::uint32_t j = boundedRandom(scratch.randomWords[k], static_cast<std::uint32_t>(i), rng);
+            std::swap(itemIndices[i - 1], itemIndices[j]);
+        }
+    }
+
+    // Valor e peso são acumulados na própria solução à medida que os itens entram
+    ACO_INSTR(AcoInstrumentation& instr = scratch.instrumentation;)
+    ACO_INSTR(std::uint64_t stepStart = readCycleCounter();)
+    for (size_t start = 0; start < numItems; start += kRandomBlock) {
+        size_t count = std::min(kRandomBlock, numItems - start);
+        rng.fillUniform(scratch.uniforms, count);
+        for (size_t k = 0; k < count; ++k) {
+            int itemIdx = itemIndices[start + k];
+            WeightT currentWeight = static_cast<WeightT>(currentSolution.weight());
+            double prob_take = calculateProbability(itemIdx, 1, currentWeight);
+
+            if (scratch.uniforms[k] < prob_take && currentWeight + weights_[itemIdx] <= capacityT_) {
+                currentSolution.add(itemIdx, values_[itemIdx], weights_[itemIdx]);
+                ACO_INSTR(++instr.probabilisticAccepts;)
+            } else {
+                ACO_INSTR(++instr.probabilisticRejects;)
+            }
+        }
+    }
+    ACO_INSTR(std::uint64_t greedyStart = readCycleCounter();)
+    ACO_INSTR(instr.phaseCycles[(int)AcoPhase::ProbabilisticStep] += greedyStart - stepStart;)
+
+    // Preenchimento guloso: uma única passada pela ordem pré-calculada de razão valor/peso,
+    // pulando os itens já escolhidos e parando quando nem o item mais leve restante cabe
+    const size_t n = ratioOrder_.size();
+    for (size_t k = 0; k < n; ++k) {
+        WeightT remainingCapacity = capacityT_ - static_cast<WeightT>(currentSolution.weight());
+        if (remainingCapacity < minWeightFromRank_[k]) {
+            break;
+        }
+        int itemIdx = ratioOrder_[k];
+        if (!currentSolution.test(itemIdx) && weights_[itemIdx] <= remainingCapacity) {
+            currentSolution.add(itemIdx, values_[itemIdx], weights_[itemIdx]);
+            ACO_INSTR(++instr.greedyInsertions;)
+        }
+    }
+    ACO_INSTR(instr.phaseCycles[(int)AcoPhase::GreedyFill] += readCycleCounter() - greedyStart;)
+}
+
+ACO_ENGINE_TEMPLATE
+double ACO_ENGINE::calculateProbability(int itemIndex, int option, WeightT currentWeight) const {
+    if (option == 1 && (currentWeight + weights_[itemIndex] > capacityT_)) {
+        return 0.0;
+    }
+
+    double take = attractivenessTake_[itemIndex];
+    double notTake = attractivenessNotTake_[itemIndex];
+
+    double numerator = (option == 1) ? take : notTake;
+    double totalDenominator = take + notTake;
+
+    return (totalDenominator == 0.0) ? 0.5 : (numerator / totalDenominator);
+}
+
+ACO_ENGINE_TEMPLATE
+double ACO_ENGINE::getHeuristicInformation(int itemIndex) const {
+    return Heuristic::eta(items_[itemIndex]);
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::updatePheromones(const std::vector<Solution>& solutions) {
+    // Ordena índices de formigas em vez de copiar soluções: maior valor primeiro e,
+    // no empate, a mesma ordem lexicográfica usada antes sobre as soluções.
+    // Só as primeiras UpdateRule::kRankedAnts posições precisam ficar ordenadas.
+    // Com depósito único, as cópias repetidas marcadas na avaliação ficam de fora
+    const bool skipDuplicates = uniqueDeposits_ && duplicateMode_ != DuplicateCacheMode::Off;
+    rankedAnts_.clear();
+    for (int ant = 0; ant < (int)solutions.size(); ++ant) {
+        if (isFeasible(solutions[ant]) && !(skipDuplicates && duplicateAnt_[ant])) {
+            rankedAnts_.push_back(ant);
+        }
+    }
+
+    int antsToRank = std::min((int)rankedAnts_.size(), UpdateRule::kRankedAnts);
+    std::partial_sort(rankedAnts_.begin(), rankedAnts_.begin() + antsToRank, rankedAnts_.end(),
+                      [&solutions](int a, int b) {
+                          const Solution& sa = solutions[a];
+                          const Solution& sb = solutions[b];
+                          if (sa.value() != sb.value()) {
+                              return sa.value() > sb.value();
+                          }
+                          return sb < sa;
+                      });
+
+    PheromoneState state = pheromoneState();
+    DepositSource source{&solutions, &rankedAnts_, &bestSolutionGlobal_, capacity_};
+    std::size_t floorHits = updateRule_.apply(state, source);
+    ACO_INSTR(instrumentation_.pheromoneFloorHits += floorHits;)
+    (void)floorHits;
+
+    updateAttractiveness();
+}
+
+ACO_ENGINE_TEMPLATE
+PheromoneState ACO_ENGINE::pheromoneState() {
+    return {pheromoneTake_.data(), pheromoneNotTake_.data(), items_.size(), kernels_, evaporationRate_};
+}
+
+ACO_ENGINE_TEMPLATE
+bool ACO_ENGINE::isFeasible(const Solution& solution) const {
+    return solution.weight() <= capacity_;
+}
+
+ACO_ENGINE_TEMPLATE
+std::tuple<std::vector<int>, int, int> ACO_ENGINE::solve() {
+    SolveResult result = solve(SolveLimits());
+    return {result.solution, result.bestValue, result.worstValue};
+}
+
+ACO_ENGINE_TEMPLATE
+SolveResult ACO_ENGINE::solve(const SolveLimits& limits) {
+    bestValueGlobal_ = 0;
+    bestSolutionGlobal_.reset(items_.size());
+    bestValuePerIteration_.clear();
+    instrumentation_.reset();
+    for (AntScratch& scratch : scratch_) {
+        scratch.allocations = 0;
+        scratch.instrumentation.reset();
+    }
+    if (warmStartSolution_.size() == items_.size()) {
+        bestSolutionGlobal_ = warmStartSolution_;
+        bestValueGlobal_ = static_cast<int>(warmStartSolution_.value());
+    }
+    publishIncumbent(0, 0.0);
+    if (duplicateMode_ == DuplicateCacheMode::CrossIteration) {
+        // Arquivo das soluções vistas: as comparações bit a bit confirmam cada acerto do cache
+        std::size_t words = std::max<std::size_t>(bestSolutionGlobal_.numWords(), 1);
+        seenSlots_ = std::max<std::size_t>(std::min(kSeenFingerprints, kSeenSolutionBytes / (words * sizeof(std::uint64_t))), 1);
+        seenFingerprints_.reserve(seenSlots_);
+        seenWords_.resize(seenSlots_ * words);
+    }
+    seenFingerprints_.clear();
+    PheromoneState state = pheromoneState();
+    updateRule_.reset(state);
+
+    auto solveStartTime = std::chrono::steady_clock::now();
+    ACO_INSTR(std::uint64_t solveStartCycles = readCycleCounter();)
+
+    int worstValueGlobal = INT_MAX;  // Inicializa com valor alto para achar o mínimo viável
+    StopReason stopReason = StopReason::MaxIterations;
+    int iterationsDone = 0;
+    int bestIteration = 0;
+    double bestTimeSeconds = 0.0;
+    int iterationsWithoutImprovement = 0;
+
+    std::size_t allocationsBefore = allocationCount();
+
+    for (int iter = 0; iter < maxIterations_; ++iter) {
+        int bestValueThisIteration = 0;
+        int bestValueBefore = bestValueGlobal_;
+
+        // Fase de construção em paralelo sobre as soluções pré-alocadas de cada formiga
+        currentIteration_ = iter;
+        ACO_INSTR(std::uint64_t phaseStart = readCycleCounter();)
+        pool_->parallelFor(numAnts_, constructTask_);
+        ACO_INSTR(std::uint64_t phaseEnd = readCycleCounter();)
+        ACO_INSTR(instrumentation_.phaseCycles[(int)AcoPhase::Construction] += phaseEnd - phaseStart;)
+
+        // Busca local nas melhores formigas (maior valor; no empate, menor índice), também em paralelo
+        if (localSearch_ && eliteCount_ > 0) {
+            eliteAnts_.clear();
+            for (int ant = 0; ant < numAnts_; ++ant) {
+                eliteAnts_.push_back(ant);
+            }
+            int elites = std::min(eliteCount_, numAnts_);
+            std::partial_sort(eliteAnts_.begin(), eliteAnts_.begin() + elites, eliteAnts_.end(), [this](int a, int b) {
+                long long va = antSolutions_[a].value();
+                long long vb = antSolutions_[b].value();
+                return (va != vb) ? va > vb : a < b;
+            });
+            // Elites repetidas: só a primeira cópia é melhorada, as demais copiam o resultado
+            duplicateElites_.clear();
+            if (duplicateMode_ != DuplicateCacheMode::Off) {
+                iterationFingerprints_.clear();
+                int unique = 0;
+                for (int rank = 0; rank < elites; ++rank) {
+                    int ant = eliteAnts_[rank];
+                    int first = iterationFingerprints_.insert(antSolutions_[ant].fingerprint(), ant);
+                    if (first >= 0 && antSolutions_[first] == antSolutions_[ant]) {
+                        duplicateElites_.emplace_back(ant, first);
+                    } else {
+                        eliteAnts_[unique++] = ant;
+                    }
+                }
+                elites = unique;
+            }
+            pool_->parallelFor(elites, localSearchTask_);
+            for (const std::pair<int, int>& copy : duplicateElites_) {
+                antSolutions_[copy.first] = antSolutions_[copy.second];
+            }
+            ACO_INSTR(instrumentation_.localSearchSkipped += duplicateElites_.size();)
+            ACO_INSTR(phaseStart = phaseEnd;)
+            ACO_INSTR(phaseEnd = readCycleCounter();)
+            ACO_INSTR(instrumentation_.phaseCycles[(int)AcoPhase::LocalSearch] += phaseEnd - phaseStart;)
+        }
+
+        // Avaliação em ordem fixa de formiga, para que o resultado não dependa das threads.
+        // Repetidas não mudam o melhor nem o pior, então o cache pode pulá-las.
+        if (duplicateMode_ != DuplicateCacheMode::Off) {
+            iterationFingerprints_.clear();
+        }
+        long long traceValueSum = 0;
+        int traceFeasibleAnts = 0;
+        int traceWorstValue = INT_MAX;
+        for (int i = 0; i < numAnts_; ++i) {
+            const Solution& antSolution = antSolutions_[i];
+            int antValue = static_cast<int>(antSolution.value());
+
+            // O traço conta também as repetidas (a média é sobre todas as formigas viáveis)
+            if (traceWriter_ && isFeasible(antSolution)) {
+                traceValueSum += antValue;
+                ++traceFeasibleAnts;
+                traceWorstValue = std::min(traceWorstValue, antValue);
+            }
+
+            ACO_INSTR(++(isFeasible(antSolution) ? instrumentation_.feasibleAnts : instrumentation_.infeasibleAnts);)
+            if (duplicateMode_ != DuplicateCacheMode::Off) {
+                int first = iterationFingerprints_.insert(antSolution.fingerprint(), i);
+                duplicateAnt_[i] = (first >= 0 && antSolutions_[first] == antSolution) ? 1 : 0;
+                if (duplicateAnt_[i]) {
+                    ACO_INSTR(++instrumentation_.duplicateAnts;)
+                    continue;
+                }
+                if (duplicateMode_ == DuplicateCacheMode::CrossIteration && isSeenBefore(antSolution)) {
+                    // Já contada no melhor global numa iteração anterior, mas ainda é desta iteração
+                    if (isFeasible(antSolution) && antValue > bestValueThisIteration) {
+                        bestValueThisIteration = antValue;
+                    }
+                    ACO_INSTR(++instrumentation_.crossIterationDuplicates;)
+                    continue;
+                }
+            }
+            if (isFeasible(antSolution)) {
+                if (antValue > bestValueGlobal_) {
+                    bestValueGlobal_ = antValue;
+                    bestSolutionGlobal_ = antSolution;
+                }
+                if (antValue > bestValueThisIteration) {
+                    bestValueThisIteration = antValue;
+                }
+                if (antValue < worstValueGlobal) {
+                    worstValueGlobal = antValue;
+                }
+            }
+        }
+
+        if (bestValueGlobal_ == 0 && bestValueThisIteration > 0) {
+            bestValueGlobal_ = bestValueThisIteration;
+        }
+
+        ACO_INSTR(phaseStart = readCycleCounter();)
+        ACO_INSTR(instrumentation_.phaseCycles[(int)AcoPhase::Evaluation] += phaseStart - phaseEnd;)
+        updatePheromones(antSolutions_);
+        ACO_INSTR(instrumentation_.phaseCycles[(int)AcoPhase::PheromoneUpdate] += readCycleCounter() - phaseStart;)
+        iterationsDone = iter + 1;
+
+        // O gancho pode trazer soluções de fora (que contam como melhora desta iteração)
+        bool continueRequested = !iterationHook_ || iterationHook_(iterationsDone);
+        bestValuePerIteration_.push_back(bestValueGlobal_);
+
+        // Critérios de parada do modo anytime, verificados ao fim de cada iteração
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - solveStartTime).count();
+        if (traceWriter_) {
+            TraceRecord record;
+            record.run = traceRun_;
+            record.iteration = static_cast<std::uint32_t>(iterationsDone);
+            record.bestValue = (traceFeasibleAnts > 0) ? bestValueThisIteration + traceValueOffset_ : 0;
+            record.worstValue = (traceFeasibleAnts > 0) ? traceWorstValue + traceValueOffset_ : 0;
+            record.bestSoFar = bestValueGlobal_ + traceValueOffset_;
+            record.meanValue = (traceFeasibleAnts > 0)
+                                   ? static_cast<double>(traceValueSum) / traceFeasibleAnts + traceValueOffset_
+                                   : 0.0;
+            record.entropy = ((record.iteration - 1) % kTraceEntropyInterval == 0)
+                                 ? pheromoneEntropy(pheromoneTake_.data(), pheromoneNotTake_.data(), items_.size())
+                                 : std::numeric_limits<double>::quiet_NaN();
+            record.elapsedSeconds = elapsed;
+            traceWriter_->record(record);
+        }
+        if (bestValueGlobal_ > bestValueBefore) {
+            bestIteration = iterationsDone;
+            bestTimeSeconds = elapsed;
+            iterationsWithoutImprovement = 0;
+            publishIncumbent(bestIteration, bestTimeSeconds);
+        } else {
+            ++iterationsWithoutImprovement;
+        }
+
+        if (limits.targetValue > 0 && bestValueGlobal_ >= limits.targetValue) {
+            stopReason = StopReason::TargetReached;
+            break;
+        }
+        if (limits.timeBudgetSeconds > 0.0 && elapsed >= limits.timeBudgetSeconds) {
+            stopReason = StopReason::TimeBudget;
+            break;
+        }
+        if (limits.stagnationWindow > 0 && iterationsWithoutImprovement >= limits.stagnationWindow) {
+            stopReason = StopReason::Stagnation;
+            break;
+        }
+        if (!continueRequested) {
+            stopReason = StopReason::Interrupted;
+            break;
+        }
+    }
+
+    double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - solveStartTime).count();
+
+    // Junta os contadores das formigas e calibra ciclos -> segundos com o relógio do sistema
+    ACO_INSTR(std::uint64_t solveCycles = readCycleCounter() - solveStartCycles;)
+    ACO_INSTR(instrumentation_.cyclesPerSecond = (elapsedSeconds > 0.0) ? solveCycles / elapsedSeconds : 0.0;)
+    for (const AntScratch& scratch : scratch_) {
+        instrumentation_.merge(scratch.instrumentation);
+    }
+
+    // Soma as alocações da thread chamadora (worker 0) com as das demais threads do pool
+    iterationAllocations_ = allocationCount() - allocationsBefore;
+    for (size_t worker = 1; worker < scratch_.size(); ++worker) {
+        iterationAllocations_ += scratch_[worker].allocations;
+    }
+#ifdef ACO_COUNT_ALLOCATIONS
+    assert(iterationAllocations_ == 0 && "o laço de iterações do ACO não deve alocar memória");
+#endif
+
+    // Se não encontrou solução viável, define pior valor como zero para evitar INT_MAX no retorno
+    if (worstValueGlobal == INT_MAX) {
+        worstValueGlobal = 0;
+    }
+
+    SolveResult result;
+    result.solution = bestSolutionGlobal_.toVector();
+    result.bestValue = bestValueGlobal_;
+    result.worstValue = worstValueGlobal;
+    result.stopReason = stopReason;
+    result.iterations = iterationsDone;
+    result.bestIteration = bestIteration;
+    result.bestTimeSeconds = bestTimeSeconds;
+    result.elapsedSeconds = elapsedSeconds;
+    return result;
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::setTrace(TraceWriter* writer, std::uint32_t run, int valueOffset) {
+    traceWriter_ = writer;
+    traceRun_ = run;
+    traceValueOffset_ = valueOffset;
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::setLocalSearch(std::shared_ptr<const LocalSearch> localSearch, int eliteCount) {
+    localSearch_ = std::move(localSearch);
+    eliteCount_ = localSearch_ ? std::max(eliteCount, 0) : 0;
+    if (localSearch_) {
+        for (AntScratch& scratch : scratch_) {
+            localSearch_->prepare(scratch.localSearch);
+        }
+    }
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::setDuplicateCache(DuplicateCacheMode mode, bool uniqueDeposits) {
+    duplicateMode_ = mode;
+    uniqueDeposits_ = uniqueDeposits;
+    if (uniqueDeposits && mode == DuplicateCacheMode::Off) {
+        std::cerr << "Aviso: o depósito único precisa do cache de repetidas ligado; ignorado." << std::endl;
+    }
+}
+
+ACO_ENGINE_TEMPLATE
+bool ACO_ENGINE::isSeenBefore(const Solution& solution) {
+    // Arquivo cheio: recomeça, para que o rótulo (a posição no arquivo) caiba em seenWords_
+    if (seenFingerprints_.size() >= seenSlots_) {
+        seenFingerprints_.clear();
+    }
+    const std::size_t words = solution.numWords();
+    const int slot = static_cast<int>(seenFingerprints_.size());
+    const int seen = seenFingerprints_.insert(solution.fingerprint(), slot);
+    if (seen < 0) {
+        std::copy(solution.words(), solution.words() + words, seenWords_.begin() + slot * words);
+        return false;
+    }
+    // Colisão de 64 bits: a solução é avaliada normalmente e o arquivo fica com a mais antiga
+    return std::equal(solution.words(), solution.words() + words, seenWords_.begin() + seen * words);
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::setIterationHook(std::function<bool(int)> hook) {
+    iterationHook_ = std::move(hook);
+}
+
+ACO_ENGINE_TEMPLATE
+bool ACO_ENGINE::injectSolution(const Solution& solution) {
+    if (solution.size() != items_.size() || !isFeasible(solution)) {
+        return false;
+    }
+
+    double pheromoneDepositAmount = static_cast<double>(solution.value()) / capacity_;
+    kernels_->deposit(pheromoneTake_.data(), pheromoneNotTake_.data(), solution.words(), items_.size(),
+                      pheromoneDepositAmount);
+    updateAttractiveness();
+
+    if (solution.value() <= bestValueGlobal_) {
+        return false;
+    }
+    bestValueGlobal_ = static_cast<int>(solution.value());
+    bestSolutionGlobal_ = solution;
+    return true;
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::blendPheromones(const AlignedDoubleVector& take, const AlignedDoubleVector& notTake, double weight) {
+    const size_t n = items_.size();
+    if (take.size() != n || notTake.size() != n) {
+        return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        pheromoneTake_[i] = (1.0 - weight) * pheromoneTake_[i] + weight * take[i];
+        pheromoneNotTake_[i] = (1.0 - weight) * pheromoneNotTake_[i] + weight * notTake[i];
+    }
+    updateAttractiveness();
+}
+
+ACO_ENGINE_TEMPLATE
+const Solution& ACO_ENGINE::getBestSolution() const {
+    return bestSolutionGlobal_;
+}
+
+ACO_ENGINE_TEMPLATE
+const AlignedDoubleVector& ACO_ENGINE::getPheromoneTake() const {
+    return pheromoneTake_;
+}
+
+ACO_ENGINE_TEMPLATE
+const AlignedDoubleVector& ACO_ENGINE::getPheromoneNotTake() const {
+    return pheromoneNotTake_;
+}
+
+ACO_ENGINE_TEMPLATE
+void ACO_ENGINE::publishIncumbent(int iteration, double seconds) {
+    std::lock_guard<std::mutex> lock(incumbentMutex_);
+    incumbentSolution_ = bestSolutionGlobal_;
+    incumbentIteration_ = iteration;
+    incumbentSeconds_ = seconds;
+    incumbentValue_.store(bestValueGlobal_, std::memory_order_release);
+}
+
+ACO_ENGINE_TEMPLATE
+int ACO_ENGINE::getIncumbentValue() const {
+    return incumbentValue_.load(std::memory_order_acquire);
+}
+
+ACO_ENGINE_TEMPLATE
+Incumbent ACO_ENGINE::getIncumbent() const {
+    std::lock_guard<std::mutex> lock(incumbentMutex_);
+    Incumbent incumbent;
+    incumbent.value = incumbentValue_.load(std::memory_order_relaxed);
+    incumbent.solution = incumbentSolution_.toVector();
+    incumbent.iteration = incumbentIteration_;
+    incumbent.seconds = incumbentSeconds_;
+    return incumbent;
+}
+
+ACO_ENGINE_TEMPLATE
+const std::vector<int>& ACO_ENGINE::getBestValueHistory() const {
+    return bestValuePerIteration_;
+}
+
+ACO_ENGINE_TEMPLATE
+const AcoInstrumentation& ACO_ENGINE::getInstrumentation() const {
+    return instrumentation_;
+}
+
+ACO_ENGINE_TEMPLATE
+std::size_t ACO_ENGINE::getIterationAllocations() const {
+    return iterationAllocations_;
+}
+
+#undef ACO_ENGINE
+#undef ACO_ENGINE_TEMPLATE
+
+#endif // ACO_ENGINE_IMPL_H
@@ -0,0 +1,233 @@
+#ifndef ACO_POLICIES_H
+#define ACO_POLICIES_H
+
+#include <vector>   // Para std::vector
+#include <cmath>    // Para std::pow, std::sqrt
+#include <cstddef>  // Para std::size_t
+#include <algorithm> // Para std::min, std::max
+
+#include "utils.h"             // Para Item
+#include "solution.h"          // Para Solution
+#include "pheromone_kernels.h" // Para PheromoneKernels
+
+// Políticas de compilação do ACOEngine (ver aco_engine.h). Cada política é uma classe
+// comum, sem funções virtuais: o motor chama seus métodos diretamente e o compilador
+// resolve (e normalmente expande) tudo em tempo de compilação.
+
+// ---------------------------------------------------------------------------
+// Expoentes: tau^alpha e eta^beta
+// ---------------------------------------------------------------------------
+
+// Expoente qualquer, decidido em tempo de execução (std::pow)
+struct RuntimeExponent {
+    double exponent;
+    explicit RuntimeExponent(double e) : exponent(e) {}
+    double operator()(double x) const { return std::pow(x, exponent); }
+    static bool accepts(double) { return true; }
+};
+
+// x^N com N inteiro, expandido em multiplicações
+template <int N>
+struct IntegerExponent {
+    static_assert(N >= 0, "expoente inteiro não negativo");
+    explicit IntegerExponent(double) {}
+    double operator()(double x) const { return power(x); }
+    static bool accepts(double e) { return e == static_cast<double>(N); }
+
+    static double power(double x) {
+        double result = 1.0;
+        for (int i = 0; i < N; ++i) {  // N é constante: o laço é desenrolado pelo compilador
+            result *= x;
+        }
+        return result;
+    }
+};
+
+// x^(N/2) com N ímpar (1.5, 2.5, ...): multiplicações e uma raiz quadrada
+template <int N>
+struct HalfIntegerExponent {
+    static_assert(N > 0 && N % 2 == 1, "use IntegerExponent para expoentes inteiros");
+    explicit HalfIntegerExponent(double) {}
+    double operator()(double x) const { return IntegerExponent<N / 2>::power(x) * std::sqrt(x); }
+    static bool accepts(double e) { return e == N / 2.0; }
+};
+
+// ---------------------------------------------------------------------------
+// Heurística (visibilidade) de cada item, calculada uma vez por instância
+// ---------------------------------------------------------------------------
+
+// Razão valor/peso (itens de peso zero usam o próprio valor)
+struct RatioHeuristic {
+    static double eta(const Item& item) {
+        return (item.weight == 0) ? static_cast<double>(item.value)
+                                  : static_cast<double>(item.value) / item.weight;
+    }
+};
+
+// Só o valor do item, ignorando o peso
+struct ValueHeuristic {
+    static double eta(const Item& item) { return static_cast<double>(item.value); }
+};
+
+// ---------------------------------------------------------------------------
+// Regras de atualização do feromônio
+// ---------------------------------------------------------------------------
+
+// Feromônio da colônia, visto pela regra de atualização
+struct PheromoneState {
+    double* take;
+    double* notTake;
+    std::size_t numItems;
+    const PheromoneKernels* kernels;
+    double evaporationRate;
+};
+
+// Soluções da iteração já classificadas pelo motor: rankedAnts lista as formigas viáveis e
+// as primeiras UpdateRule::kRankedAnts estão em ordem decrescente de valor
+struct DepositSource {
+    const std::vector<Solution>* solutions;
+    const std::vector<int>* rankedAnts;
+    const Solution* bestSoFar;   // Melhor solução desde o início de solve()
+    int capacity;
+};
+
+namespace aco_detail {
+
+inline void depositSolution(PheromoneState& state, const Solution& solution, double amount) {
+    state.kernels->deposit(state.take, state.notTake, solution.words(), state.numItems, amount);
+}
+
+inline std::size_t evaporateWithFloor(PheromoneState& state, double floor) {
+    std::size_t floorHits = state.kernels->evaporate(state.take, state.numItems, 1.0 - state.evaporationRate, floor);
+    floorHits += state.kernels->evaporate(state.notTake, state.numItems, 1.0 - state.evaporationRate, floor);
+    return floorHits;
+}
+
+} // namespace aco_detail
+
+// Interface comum das regras (todas devolvem quantas entradas bateram no piso):
+//   static constexpr int kRankedAnts;   quantas formigas o motor precisa ordenar
+//   void reset(PheromoneState&);        início de cada solve()
+//   std::size_t apply(PheromoneState&, const DepositSource&);
+
+// Regra original do projeto: piso de 0.001 e as K melhores formigas depositam valor/capacidade
+template <int K>
+struct TopRankUpdate {
+    static constexpr int kRankedAnts = K;
+    void reset(PheromoneState&) {}
+    std::size_t apply(PheromoneState& state, const DepositSource& source) {
+        std::size_t floorHits = aco_detail::evaporateWithFloor(state, 0.001);
+        const std::vector<int>& ranked = *source.rankedAnts;
+        int deposits = std::min(static_cast<int>(ranked.size()), K);
+        for (int k = 0; k < deposits; ++k) {
+            const Solution& solution = (*source.solutions)[ranked[k]];
+            aco_detail::depositSolution(state, solution, static_cast<double>(solution.value()) / source.capacity);
+        }
+        return floorHits;
+    }
+};
+
+// Ant System: todas as formigas viáveis depositam valor/capacidade
+struct AntSystemUpdate {
+    static constexpr int kRankedAnts = 0;
+    void reset(PheromoneState&) {}
+    std::size_t apply(PheromoneState& state, const DepositSource& source) {
+        std::size_t floorHits = aco_detail::evaporateWithFloor(state, 0.001);
+        for (int ant : *source.rankedAnts) {
+            const Solution& solution = (*source.solutions)[ant];
+            aco_detail::depositSolution(state, solution, static_cast<double>(solution.value()) / source.capacity);
+        }
+        return floorHits;
+    }
+};
+
+// Ant System elitista: como o Ant System, mais E depósitos da melhor solução desde o início
+template <int E>
+struct ElitistUpdate {
+    static constexpr int kRankedAnts = 0;
+    void reset(PheromoneState&) {}
+    std::size_t apply(PheromoneState& state, const DepositSource& source) {
+        std::size_t floorHits = AntSystemUpdate().apply(state, source);
+        const Solution& best = *source.bestSoFar;
+        if (best.value() > 0) {
+            aco_detail::depositSolution(state, best, E * static_cast<double>(best.value()) / source.capacity);
+        }
+        return floorHits;
+    }
+};
+
+// AS-rank (Bullnheimer et al.): a formiga de posição r < W-1 deposita (W-1-r) vezes o seu
+// valor/capacidade e a melhor desde o início deposita W vezes
+template <int W>
+struct RankBasedUpdate {
+    static_assert(W >= 2, "AS-rank precisa de pelo menos uma formiga ranqueada");
+    static constexpr int kRankedAnts = W - 1;
+    void reset(PheromoneState&) {}
+    std::size_t apply(PheromoneState& state, const DepositSource& source) {
+        std::size_t floorHits = aco_detail::evaporateWithFloor(state, 0.001);
+        const std::vector<int>& ranked = *source.rankedAnts;
+        int deposits = std::min(static_cast<int>(ranked.size()), W - 1);
+        for (int r = 0; r < deposits; ++r) {
+            const Solution& solution = (*source.solutions)[ranked[r]];
+            aco_detail::depositSolution(state, solution, (W - 1 - r) * static_cast<double>(solution.value()) / source.capacity);
+        }
+        const Solution& best = *source.bestSoFar;
+        if (best.value() > 0) {
+            aco_detail::depositSolution(state, best, W * static_cast<double>(best.value()) / source.capacity);
+        }
+        return floorHits;
+    }
+};
+
+// MAX-MIN Ant System (Stützle & Hoos): só a melhor formiga da iteração deposita e o feromônio
+// fica preso em [tauMin, tauMax], com tauMax = melhor/(rho * capacidade) e tauMin derivado de
+// pBest = 0.05 (duas opções por item). Após RestartWindow iterações sem melhora da melhor
+// solução, todo o feromônio volta para tauMax (reinício).
+template <int RestartWindow>
+struct MaxMinUpdate {
+    static constexpr int kRankedAnts = 1;
+
+    long long lastBestValue = 0;
+    int iterationsWithoutImprovement = 0;
+    int restarts = 0;
+
+    void reset(PheromoneState&) {
+        lastBestValue = 0;
+        iterationsWithoutImprovement = 0;
+        restarts = 0;
+    }
+
+    std::size_t apply(PheromoneState& state, const DepositSource& source) {
+        const long long bestValue = source.bestSoFar->value();
+        const double tauMax = static_cast<double>(bestValue) / (state.evaporationRate * source.capacity);
+        const double pBestRoot = std::pow(0.05, 1.0 / std::max<std::size_t>(state.numItems, 1));
+        const double tauMin = std::max(tauMax * (1.0 - pBestRoot) / pBestRoot, 1e-12);
+
+        if (bestValue > lastBestValue) {
+            lastBestValue = bestValue;
+            iterationsWithoutImprovement = 0;
+        } else if (++iterationsWithoutImprovement >= RestartWindow && tauMax > 0.0) {
+            std::fill(state.take, state.take + state.numItems, tauMax);
+            std::fill(state.notTake, state.notTake + state.numItems, tauMax);
+            iterationsWithoutImprovement = 0;
+            ++restarts;
+            return 0;
+        }
+
+        std::size_t floorHits = aco_detail::evaporateWithFloor(state, tauMin);
+        const std::vector<int>& ranked = *source.rankedAnts;
+        if (!ranked.empty()) {
+            const Solution& iterationBest = (*source.solutions)[ranked[0]];
+            aco_detail::depositSolution(state, iterationBest, static_cast<double>(iterationBest.value()) / source.capacity);
+        }
+        if (tauMax > 0.0) {
+            for (std::size_t i = 0; i < state.numItems; ++i) {
+                state.take[i] = std::min(state.take[i], tauMax);
+                state.notTake[i] = std::min(state.notTake[i], tauMax);
+            }
+        }
+        return floorHits;
+    }
+};
+
+#endif // ACO_POLICIES_H
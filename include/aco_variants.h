@@ -0,0 +1,31 @@
+#ifndef ACO_VARIANTS_H
+#define ACO_VARIANTS_H
+
+#include "aco.h"
+
+// Variantes clássicas do ACO montadas a partir das políticas de aco_policies.h.
+// Cada uma é instanciada uma única vez em aco_variants.cpp.
+
+// Ant System: todas as formigas viáveis depositam
+using AntSystemACO = ACOEngine<AntSystemUpdate, RatioHeuristic, int, RuntimeExponent, RuntimeExponent>;
+
+// Ant System elitista, com peso 5 para a melhor solução desde o início
+using ElitistACO = ACOEngine<ElitistUpdate<5>, RatioHeuristic, int, RuntimeExponent, RuntimeExponent>;
+
+// AS-rank com w = 6 (as 5 melhores da iteração mais a melhor desde o início)
+using RankBasedACO = ACOEngine<RankBasedUpdate<6>, RatioHeuristic, int, RuntimeExponent, RuntimeExponent>;
+
+// MAX-MIN Ant System com reinício após 50 iterações sem melhora
+using MaxMinACO = ACOEngine<MaxMinUpdate<50>, RatioHeuristic, int, RuntimeExponent, RuntimeExponent>;
+
+// Regra padrão com alpha = 1.5 e beta = 2.5 fixados em tempo de compilação:
+// tau^alpha e eta^beta viram multiplicações e uma raiz quadrada em vez de std::pow
+using FastExponentACO = ACOEngine<TopRankUpdate<5>, RatioHeuristic, int, HalfIntegerExponent<3>, HalfIntegerExponent<5>>;
+
+extern template class ACOEngine<AntSystemUpdate, RatioHeuristic, int, RuntimeExponent, RuntimeExponent>;
+extern template class ACOEngine<ElitistUpdate<5>, RatioHeuristic, int, RuntimeExponent, RuntimeExponent>;
+extern template class ACOEngine<RankBasedUpdate<6>, RatioHeuristic, int, RuntimeExponent, RuntimeExponent>;
+extern template class ACOEngine<MaxMinUpdate<50>, RatioHeuristic, int, RuntimeExponent, RuntimeExponent>;
+extern template class ACOEngine<TopRankUpdate<5>, RatioHeuristic, int, HalfIntegerExponent<3>, HalfIntegerExponent<5>>;
+
+#endif // ACO_VARIANTS_H
@@ -0,0 +1,42 @@
+#ifndef ALIGNED_ALLOCATOR_H
+#define ALIGNED_ALLOCATOR_H
+
+#include <cstddef>  // Para std::size_t
+#include <new>      // Para std::align_val_t e std::bad_alloc
+#include <vector>   // Para std::vector
+
+// Alocador que garante alinhamento de Alignment bytes (por padrão, uma linha de cache),
+// para que os kernels SIMD possam percorrer os vetores sem cruzar linhas desnecessariamente.
+template <typename T, std::size_t Alignment = 64>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+// Vetor contíguo de doubles alinhado a 64 bytes
+using AlignedDoubleVector = std::vector<double, AlignedAllocator<double, 64>>;
+
+#endif // ALIGNED_ALLOCATOR_H
@@ -0,0 +1,15 @@
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <cstddef>  // Para std::size_t
+
+// Gancho de teste para alocações no heap.
+// Compilando com -DACO_COUNT_ALLOCATIONS, src/alloc_counter.cpp substitui o operator new
+// global e conta as alocações feitas por cada thread. O ACO usa esse contador para
+// verificar (com assert) que o laço de iterações não faz nenhuma alocação.
+// Sem a macro, allocationCount() sempre devolve 0 e nada é substituído.
+
+// Número de alocações feitas pela thread chamadora até agora
+std::size_t allocationCount();
+
+#endif // ALLOC_COUNTER_H
@@ -0,0 +1,80 @@
+#ifndef BATCH_SOLVER_H
+#define BATCH_SOLVER_H
+
+#include <vector>   // Para std::vector
+#include <string>   // Para std::string
+#include <iosfwd>   // Para std::istream, std::ostream
+#include <chrono>   // Para std::chrono::steady_clock
+#include <cstddef>  // Para std::size_t
+
+#include "utils.h"  // Para Item
+
+// Modo lote: um processo de vida longa que lê tarefas da entrada padrão, uma por linha, e
+// escreve cada resultado (uma linha JSON) assim que ele fica pronto, fora de ordem.
+//
+// Formato da tarefa: pares chave=valor separados por espaços. Linhas vazias ou iniciadas
+// por '#' são ignoradas.
+//   id=<texto>             Identificador devolvido no resultado (padrão: número da linha)
+//   instancia=<caminho>    Arquivo de instância (texto ou binário), ou então:
+//   capacidade=<C> itens=<v:p,v:p,...>   a instância na própria linha
+//   formigas= iteracoes= evaporacao= alfa= beta= seed=   parâmetros do ACO
+//   prazo=<segundos>       Prazo desde a leitura da linha; o tempo na fila conta. Tarefa que
+//                          espera além do prazo nem é resolvida (status "expirado").
+//   alvo=<valor>           Para assim que encontrar uma solução com esse valor
+// Exemplo:
+//   id=a instancia=data/knapsack-instance.txt seed=7 prazo=0.5
+//   id=b capacidade=10 itens=6:5,5:4,4:3 iteracoes=50
+
+// Parâmetros do lote e valores padrão das tarefas
+struct BatchConfig {
+    int numWorkers = 0;            // Threads resolvendo tarefas; <= 0 usa hardware_concurrency()
+    std::size_t queueCapacity = 64;  // Tarefas lidas e ainda não iniciadas; além disso a leitura espera
+    int numAnts = 50;
+    int maxIterations = 400;
+    double evaporationRate = 0.3;
+    double alpha = 1.5;
+    double beta = 2.5;
+    unsigned int seed = 12345;
+    // Tarefas em que a DP custa menos que formigas * iteracoes construções (exactFastPathApplies)
+    // são respondidas com o ótimo, sem rodar o ACO ("parada":"exato")
+    bool useExactFastPath = false;
+};
+
+struct BatchJob {
+    std::string id;
+    std::string instancePath;     // Vazio quando a instância veio na linha
+    int capacity = 0;
+    std::vector<Item> items;      // Instância na linha
+    int numAnts = 0;
+    int maxIterations = 0;
+    double evaporationRate = 0.0;
+    double alpha = 0.0;
+    double beta = 0.0;
+    unsigned int seed = 0;
+    double deadlineSeconds = 0.0;  // <= 0: sem prazo
+    int targetValue = 0;
+    std::chrono::steady_clock::time_point received;
+};
+
+// Interpreta uma linha de tarefa; em caso de erro preenche error e retorna false
+bool parseBatchJob(const std::string& line, const BatchConfig& defaults, BatchJob& job, std::string& error);
+
+// Resumo apresentado no encerramento
+struct BatchSummary {
+    long long jobs = 0;
+    long long solved = 0;
+    long long expired = 0;
+    long long failed = 0;          // Linha inválida ou instância ilegível
+    double wallSeconds = 0.0;      // Da primeira leitura ao último resultado
+    double jobsPerSecond = 0.0;
+    double latencyP50 = 0.0;       // Latência = leitura da linha até a escrita do resultado
+    double latencyP90 = 0.0;
+    double latencyP99 = 0.0;
+    double latencyMax = 0.0;
+};
+
+// Executa o lote até o fim da entrada: uma thread lê e enfileira, numWorkers threads resolvem.
+// Cada thread de trabalho mantém um único ACO, reaproveitado entre tarefas com ACO::reset().
+BatchSummary runBatch(std::istream& input, std::ostream& output, const BatchConfig& config);
+
+#endif // BATCH_SOLVER_H
@@ -0,0 +1,65 @@
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <deque>               // Para std::deque
+#include <mutex>               // Para std::mutex
+#include <condition_variable>  // Para std::condition_variable
+#include <cstddef>             // Para std::size_t
+#include <utility>             // Para std::move
+
+// Fila bloqueante de capacidade fixa entre produtores e consumidores.
+// push() bloqueia enquanto a fila está cheia (contrapressão sobre quem produz) e pop() bloqueia
+// enquanto está vazia. Depois de close(), push() recusa novos itens e pop() devolve false assim
+// que a fila esvaziar, o que encerra os consumidores.
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(std::size_t capacity) : capacity_(capacity > 0 ? capacity : 1), closed_(false) {}
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    // Devolve false se a fila já foi fechada
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notFull_.wait(lock, [this] { return closed_ || items_.size() < capacity_; });
+        if (closed_) {
+            return false;
+        }
+        items_.push_back(std::move(item));
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    // Devolve false quando a fila está fechada e vazia
+    bool pop(T& item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notEmpty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+        if (items_.empty()) {
+            return false;
+        }
+        item = std::move(items_.front());
+        items_.pop_front();
+        notFull_.notify_one();
+        return true;
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        notEmpty_.notify_all();
+        notFull_.notify_all();
+    }
+
+    std::size_t capacity() const { return capacity_; }
+
+private:
+    std::deque<T> items_;
+    std::size_t capacity_;
+    bool closed_;
+    std::mutex mutex_;
+    std::condition_variable notEmpty_;
+    std::condition_variable notFull_;
+};
+
+#endif // BOUNDED_QUEUE_H
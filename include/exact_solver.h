@@ -0,0 +1,56 @@
+#ifndef EXACT_SOLVER_H
+#define EXACT_SOLVER_H
+
+#include <vector>   // Para std::vector
+#include <cstddef>  // Para std::size_t
+
+#include "utils.h"  // Para Item
+
+// Solvers exatos da mochila 0/1, usados como referência (gap real do ACO) e como
+// atalho quando a instância é pequena o bastante para ser resolvida diretamente.
+
+enum class ExactMethod {
+    DynamicProgramming,  // O(n * C) tempo, O(C) memória (+ n * C bits para reconstruir)
+    BranchAndBound       // Busca em profundidade com o limite de Dantzig em cada nó
+};
+
+const char* exactMethodName(ExactMethod method);
+
+struct ExactResult {
+    bool optimal;               // false se o branch-and-bound parou no limite de nós ou de tempo
+    long long value;            // Ótimo (ou melhor valor encontrado, se optimal == false)
+    long long upperBound;       // Igual a value quando optimal; senão, o limite de Dantzig inteiro
+    std::vector<int> solution;  // 0/1 por item; vazio se a reconstrução não foi pedida
+    ExactMethod method;
+    long long nodes;            // Nós explorados (branch-and-bound) ou células calculadas (DP)
+    double seconds;
+};
+
+// Programação dinâmica sobre a capacidade com um único vetor rolante.
+// Com reconstruct, guarda um bit de decisão por (item, capacidade) para recuperar a solução.
+ExactResult solveByDynamicProgramming(int capacity, const std::vector<Item>& items, bool reconstruct = true);
+
+// Branch-and-bound com limite de Dantzig calculado em O(log n) por nó (somas prefixadas).
+// Limites <= 0 desligam o respectivo critério.
+ExactResult solveByBranchAndBound(int capacity, const std::vector<Item>& items,
+                                  long long nodeLimit = 0, double timeLimitSeconds = 0.0);
+
+// Escolhe o método: DP quando a memória dela cabe em kMaxDynamicProgrammingBytes, senão branch-and-bound
+ExactResult solveExact(int capacity, const std::vector<Item>& items,
+                       long long nodeLimit = 0, double timeLimitSeconds = 0.0);
+
+// Memória que solveByDynamicProgramming aloca: o vetor rolante de C + 1 long long e, com
+// reconstruct, n linhas de ceil((C + 1) / 64) palavras de bits de decisão. Com n pequeno e C
+// grande quem domina é o vetor rolante, por isso o limite é sobre bytes e não sobre n * (C + 1).
+long long dynamicProgrammingBytes(int capacity, std::size_t numItems, bool reconstruct);
+
+constexpr long long kMaxDynamicProgrammingBytes = 256LL << 20;  // 256 MB
+
+// Atalho: verdadeiro quando a DP cabe no limite de memória e custa menos que antEvaluations
+// construções de formiga.
+// Estimativa calibrada: decidir um item numa formiga custa cerca de kCellsPerAntItem células de DP
+// (medido na instância de 100 itens: ~39 ns por formiga-item contra ~1.6 ns por célula).
+constexpr long long kCellsPerAntItem = 20;
+bool exactFastPathApplies(int capacity, std::size_t numItems, long long antEvaluations);
+
+#endif // EXACT_SOLVER_H
@@ -0,0 +1,65 @@
+#ifndef FINGERPRINT_SET_H
+#define FINGERPRINT_SET_H
+
+#include <vector>   // Para std::vector
+#include <cstdint>  // Para std::uint64_t, std::uint32_t
+#include <cstddef>  // Para std::size_t
+#include <string>   // Para std::string
+
+// Como o ACO usa o cache de soluções repetidas
+enum class DuplicateCacheMode {
+    Off,            // Toda formiga é avaliada e passa pela busca local (padrão)
+    PerIteration,   // Repetidas dentro da mesma iteração são avaliadas uma vez só
+    CrossIteration  // Também pula a avaliação de soluções já vistas em iterações anteriores
+};
+
+const char* duplicateCacheModeName(DuplicateCacheMode mode);
+bool parseDuplicateCacheMode(const std::string& name, DuplicateCacheMode& mode);
+
+// Conjunto de impressões digitais de 64 bits com endereçamento aberto (sondagem linear).
+// Cada entrada guarda um rótulo (por exemplo, o índice da formiga dona da solução).
+// clear() é O(1): as entradas são marcadas com uma geração, e só as da geração atual valem.
+// Não aloca depois de reserve(); inserir uma chave nova além da metade da capacidade esvazia
+// o conjunto.
+class FingerprintSet {
+public:
+    FingerprintSet() : mask_(0), size_(0), generation_(1) { reserve(0); }
+
+    // Dimensiona para até expectedEntries entradas com ocupação de no máximo 50%
+    void reserve(std::size_t expectedEntries);
+    void clear();
+
+    // Insere a impressão digital; se ela já estava no conjunto, não insere e devolve o rótulo
+    // guardado. Devolve -1 quando a inserção acontece.
+    int insert(std::uint64_t fingerprint, int tag) {
+        std::size_t slot = static_cast<std::size_t>(fingerprint) & mask_;
+        while (generations_[slot] == generation_) {
+            if (keys_[slot] == fingerprint) {
+                return tags_[slot];
+            }
+            slot = (slot + 1) & mask_;
+        }
+        // Só uma chave nova esvazia a tabela cheia; um acerto não perde o que já está guardado
+        if (2 * (size_ + 1) > generations_.size()) {
+            clear();
+            slot = static_cast<std::size_t>(fingerprint) & mask_;
+        }
+        generations_[slot] = generation_;
+        keys_[slot] = fingerprint;
+        tags_[slot] = tag;
+        ++size_;
+        return -1;
+    }
+
+    std::size_t size() const { return size_; }
+
+private:
+    std::vector<std::uint64_t> keys_;
+    std::vector<int> tags_;
+    std::vector<std::uint32_t> generations_;
+    std::size_t mask_;
+    std::size_t size_;
+    std::uint32_t generation_;
+};
+
+#endif // FINGERPRINT_SET_H
@@ -0,0 +1,39 @@
+#ifndef INSTANCE_GENERATOR_H
+#define INSTANCE_GENERATOR_H
+
+#include <vector>
+#include <string>
+#include <utility> // Para std::pair
+
+#include "utils.h" // Para Item
+
+// Classes clássicas de instâncias difíceis da mochila (Pisinger, "Where are the hard knapsack problems?")
+enum class InstanceClass {
+    Uncorrelated,               // valor e peso independentes em [1, R]
+    WeaklyCorrelated,           // valor em [peso - R/10, peso + R/10]
+    StronglyCorrelated,         // valor = peso + R/10
+    InverseStronglyCorrelated,  // peso = valor + R/10
+    SubsetSum                   // valor = peso
+};
+
+// Nome curto da classe (usado na saída dos benchmarks) e o inverso
+const char* instanceClassName(InstanceClass instanceClass);
+bool parseInstanceClass(const std::string& name, InstanceClass& instanceClass);
+
+// Todas as classes, na ordem da enumeração
+const std::vector<InstanceClass>& allInstanceClasses();
+
+// Gera uma instância com numItems itens e coeficientes em [1, range].
+// A capacidade é capacityRatio * (soma dos pesos), como nas séries de Pisinger.
+// Mesmo formato de retorno de readKnapsackInstance: {capacidade, itens}.
+std::pair<int, std::vector<Item>> generateInstance(InstanceClass instanceClass, int numItems, unsigned int seed,
+                                                   int range = 1000, double capacityRatio = 0.5);
+
+// Versão alterada de uma instância, simulando a atualização incremental do mesmo problema:
+// fraction/3 dos itens saem, outro tanto de itens novos entra (cópias com ±10% de ruído de
+// itens existentes, com ids novos), fraction/3 dos itens têm o valor alterado em até ±10% e
+// a capacidade varia em até ±1%. Os itens que ficam mantêm o Item::id.
+std::pair<int, std::vector<Item>> perturbInstance(int capacity, const std::vector<Item>& items, double fraction,
+                                                  unsigned int seed);
+
+#endif // INSTANCE_GENERATOR_H
@@ -0,0 +1,92 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <cstdint>  // Para std::uint64_t
+#include <string>   // Para std::string
+#include <chrono>   // Para o contador de reserva fora de x86
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>  // Para __rdtsc
+#endif
+
+// Instrumentação do ACO: ciclos por fase e contadores do caminho crítico.
+// Compile com -DACO_INSTRUMENTATION=0 para remover toda a coleta (custo zero);
+// nesse caso o acessor continua existindo, mas devolve tudo zerado.
+#ifndef ACO_INSTRUMENTATION
+#define ACO_INSTRUMENTATION 1
+#endif
+
+#if ACO_INSTRUMENTATION
+#define ACO_INSTR(...) __VA_ARGS__
+#else
+#define ACO_INSTR(...)
+#endif
+
+// Fases medidas. Construction e LocalSearch são o tempo de relógio das fases paralelas (medido
+// pela thread que chama solve); ProbabilisticStep e GreedyFill somam os ciclos de todas as formigas.
+enum class AcoPhase {
+    Construction,
+    ProbabilisticStep,
+    GreedyFill,
+    LocalSearch,
+    Evaluation,
+    PheromoneUpdate,
+    Count
+};
+
+constexpr int kAcoPhaseCount = static_cast<int>(AcoPhase::Count);
+
+const char* acoPhaseName(AcoPhase phase);
+
+// Contador de ciclos (TSC em x86; nanossegundos de steady_clock nas demais arquiteturas)
+inline std::uint64_t readCycleCounter() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+struct AcoInstrumentation {
+    std::uint64_t phaseCycles[kAcoPhaseCount];
+
+    std::uint64_t probabilisticAccepts;  // Itens incluídos no sorteio probabilístico
+    std::uint64_t probabilisticRejects;  // Itens recusados no sorteio (ou que não cabiam)
+    std::uint64_t greedyInsertions;      // Itens incluídos no preenchimento guloso
+    std::uint64_t feasibleAnts;
+    std::uint64_t infeasibleAnts;
+    std::uint64_t pheromoneFloorHits;    // Entradas de feromônio presas no piso de 0.001
+    std::uint64_t localSearchMoves;      // Movimentos de melhora aplicados pela busca local
+    std::uint64_t localSearchImproved;   // Formigas melhoradas pela busca local
+    std::uint64_t localSearchSkipped;    // Elites repetidas que receberam o resultado de outra cópia
+    std::uint64_t duplicateAnts;         // Formigas iguais a outra da mesma iteração (não reavaliadas)
+    std::uint64_t crossIterationDuplicates;  // Soluções já vistas em iterações anteriores
+
+    // Ciclos por segundo, calibrado com steady_clock ao longo de cada solve()
+    double cyclesPerSecond;
+
+    AcoInstrumentation() { reset(); }
+
+    void reset();
+
+    // Soma ciclos e contadores de outra instância (por exemplo, de outra thread)
+    void merge(const AcoInstrumentation& other);
+
+    double phaseSeconds(AcoPhase phase) const;
+
+    // Falso quando os ciclos não foram medidos (compilado com -DACO_INSTRUMENTATION=0 ou antes do
+    // primeiro solve()): phaseSeconds() devolve 0, e as exportações gravam os tempos como null
+    bool hasPhaseTimes() const { return cyclesPerSecond > 0.0; }
+
+    // Fração das formigas avaliadas que o cache de repetidas pulou (dentro da iteração ou entre
+    // iterações), dado o total de formigas construídas
+    double duplicateHitRate(std::uint64_t antsBuilt) const;
+
+    // Exportação: um objeto JSON, ou cabeçalho e linha de CSV (tempos não medidos ficam vazios)
+    std::string toJson() const;
+    static std::string csvHeader();
+    std::string toCsvRow() const;
+};
+
+#endif // INSTRUMENTATION_H
@@ -0,0 +1,117 @@
+#ifndef ISLAND_MODEL_H
+#define ISLAND_MODEL_H
+
+#include <vector>   // Para std::vector
+#include <memory>   // Para std::unique_ptr
+#include <atomic>   // Para std::atomic
+#include <cstddef>  // Para std::size_t
+#include <string>   // Para std::string
+
+#include "aco.h"
+#include "utils.h"
+#include "solution.h"
+#include "thread_pool.h"
+#include "aligned_allocator.h"
+
+// Como as ilhas trocam soluções
+enum class MigrationTopology {
+    Ring,            // A ilha i envia só para a ilha (i + 1) % numIslands
+    FullyConnected   // Cada ilha envia para todas as outras
+};
+
+const char* migrationTopologyName(MigrationTopology topology);
+bool parseMigrationTopology(const std::string& name, MigrationTopology& topology);
+
+struct IslandConfig {
+    int numIslands = 4;
+    int migrationInterval = 10;   // Migra a cada K iterações de cada ilha
+    MigrationTopology topology = MigrationTopology::Ring;
+    double pheromoneBlend = 0.0;  // Peso do feromônio recebido na mistura (0 = só envia a melhor solução)
+};
+
+struct IslandResult {
+    std::vector<int> solution;
+    int bestValue;
+    int worstValue;
+    int bestIsland;             // Ilha que encontrou primeiro o melhor valor
+    StopReason stopReason;      // Motivo de parada da ilha vencedora
+    double bestTimeSeconds;     // Desde o início de solve() até o melhor valor aparecer
+    double elapsedSeconds;
+    long long antsBuilt;        // Formigas construídas somando todas as ilhas
+    long long migrationsSent;
+    long long migrationsImproved;  // Migrações que melhoraram a melhor solução da ilha receptora
+    std::vector<SolveResult> islands;
+};
+
+// Modelo de ilhas: várias colônias ACO independentes, cada uma em sua própria thread,
+// que a cada K iterações trocam a melhor solução (e, opcionalmente, o feromônio).
+// A troca usa caixas de correio sem trava, uma por aresta da topologia: quem envia nunca
+// espera quem recebe, e uma mensagem não lida é simplesmente substituída pela mais nova.
+// Cada ilha recebe uma seed derivada de (seed, ilha); como as ilhas rodam de forma
+// assíncrona, o resultado com mais de uma ilha depende do escalonamento das threads.
+class IslandModel {
+public:
+    // numAntsPerIsland formigas em cada uma das config.numIslands colônias
+    IslandModel(int numAntsPerIsland, double evaporationRate, double alpha, double beta,
+                int capacity, const std::vector<Item>& items, int maxIterations, unsigned int seed,
+                const IslandConfig& config);
+    ~IslandModel();
+
+    IslandModel(const IslandModel&) = delete;
+    IslandModel& operator=(const IslandModel&) = delete;
+
+    // Os limites valem para cada ilha; a primeira que atinge o alvo interrompe as demais
+    IslandResult solve(const SolveLimits& limits);
+
+    int numIslands() const;
+
+private:
+    // Conteúdo de uma migração, pré-alocado para o tamanho da instância
+    struct MigrationMessage {
+        Solution solution;
+        AlignedDoubleVector pheromoneTake;
+        AlignedDoubleVector pheromoneNotTake;
+    };
+
+    // Buffer triplo com um escritor e um leitor: o escritor preenche seu buffer e o troca
+    // atomicamente pelo do meio; o leitor só troca se houver uma mensagem nova no meio.
+    // Nenhum dos lados bloqueia nem aloca memória.
+    class Mailbox {
+    public:
+        Mailbox(std::size_t numItems, bool withPheromones);
+
+        MigrationMessage& writeSlot();
+        void publish();
+
+        // Mensagem mais recente ainda não lida, ou nullptr
+        const MigrationMessage* receive();
+
+    private:
+        static constexpr int kFresh = 4;  // Bit que marca o buffer do meio como não lido
+
+        MigrationMessage slots_[3];
+        std::atomic<int> middle_;
+        int back_;   // Só o escritor usa
+        int front_;  // Só o leitor usa
+    };
+
+    struct Island {
+        std::unique_ptr<ACO> aco;
+        std::vector<Mailbox*> outbox;  // Arestas de saída (esta ilha escreve)
+        std::vector<Mailbox*> inbox;   // Arestas de entrada (esta ilha lê)
+        long long migrationsSent;
+        long long migrationsImproved;
+        double startOffsetSeconds;     // Início do solve() da ilha em relação ao do modelo
+    };
+
+    bool migrate(Island& island, int iteration);
+
+    IslandConfig config_;
+    int numAntsPerIsland_;
+    std::vector<Island> islands_;
+    std::vector<std::unique_ptr<Mailbox>> mailboxes_;
+    std::unique_ptr<ThreadPool> pool_;
+    std::atomic<bool> stopRequested_;
+};
+
+#endif // ISLAND_MODEL_H
@@ -0,0 +1,78 @@
+#ifndef LOCAL_SEARCH_H
+#define LOCAL_SEARCH_H
+
+#include <vector>   // Para std::vector
+#include <cstddef>  // Para std::size_t
+
+#include "utils.h"     // Para Item
+#include "solution.h"  // Para Solution
+
+// Área de trabalho de uma busca local, uma por thread, dimensionada antes do laço de iterações
+struct LocalSearchScratch {
+    std::vector<int> dropCandidates;  // Itens dentro da mochila, pior razão valor/peso primeiro
+    std::vector<int> addCandidates;   // Itens fora da mochila, melhor razão primeiro
+    std::vector<int> heavyCandidates; // Itens de fora já varridos, pesados demais para qualquer troca
+    // Posições na ordem de razão até onde as listas já foram varridas: dropCandidates tem todos
+    // os itens de dentro com posição >= dropCursor, e cada item de fora com posição < addCursor
+    // está em addCandidates ou em heavyCandidates (as duas em ordem de posição)
+    std::size_t dropCursor = 0;
+    std::size_t addCursor = 0;
+};
+
+// Estágio de busca local plugável, aplicado pelo ACO às melhores formigas de cada iteração.
+// improve() é chamado em paralelo para formigas diferentes: deve ser const, não pode alocar
+// memória (a área de trabalho vem de prepare()) e só pode deixar a solução mais valiosa e viável.
+class LocalSearch {
+public:
+    virtual ~LocalSearch() = default;
+
+    // Reserva na área de trabalho tudo o que improve() vai usar
+    virtual void prepare(LocalSearchScratch& scratch) const = 0;
+
+    // Melhora a solução no lugar; devolve o número de movimentos aplicados
+    virtual int improve(Solution& solution, LocalSearchScratch& scratch) const = 0;
+};
+
+// Vizinhanças clássicas da mochila com avaliação incremental: cada movimento é avaliado em O(1)
+// a partir do valor, do peso e da capacidade residual que a Solution já mantém.
+//   add:      inclui um item que cabe na capacidade residual
+//   1-1:      troca um item de dentro por um de fora mais valioso que caiba
+//   2-1:      tira dois itens de dentro e põe um de fora que valha mais que os dois
+//   drop/add: tira um item e reenche gulosamente com os candidatos de fora
+// Todos os movimentos só olham duas listas de no máximo candidateListSize itens pela ordem de
+// razão valor/peso (os piores de dentro e os melhores de fora). As listas são montadas uma vez
+// por improve(), varrendo a ordem de razão a partir de cada ponta até enchê-las, e depois
+// atualizadas a cada item que entra ou sai: o item trocado sai da sua lista, entra na outra se
+// cair na faixa já varrida, e a lista que ficou curta continua a varredura de onde parou. Itens
+// de fora pesados demais para qualquer troca ficam à parte e são revistos quando a folga cresce.
+// Um movimento custa O(candidateListSize + itens à parte) mais o avanço dos cursores, que ao
+// longo de um improve() somam cerca de uma passada pela ordem de razão. Aplica sempre o melhor
+// movimento de cada tipo, na ordem acima, até não haver melhora ou atingir maxMoves.
+class SwapLocalSearch : public LocalSearch {
+public:
+    SwapLocalSearch(int capacity, const std::vector<Item>& items, int candidateListSize = 12, int maxMoves = 32);
+
+    void prepare(LocalSearchScratch& scratch) const override;
+    int improve(Solution& solution, LocalSearchScratch& scratch) const override;
+
+private:
+    void refillCandidates(const Solution& solution, LocalSearchScratch& scratch) const;
+    void insertByRank(std::vector<int>& adds, int idx) const;
+    void takeItem(Solution& solution, LocalSearchScratch& scratch, int idx) const;
+    void dropItem(Solution& solution, LocalSearchScratch& scratch, int idx) const;
+    bool tryAdd(Solution& solution, LocalSearchScratch& scratch) const;
+    bool trySwapOneOne(Solution& solution, LocalSearchScratch& scratch) const;
+    bool trySwapTwoOne(Solution& solution, LocalSearchScratch& scratch) const;
+    bool tryDropAdd(Solution& solution, LocalSearchScratch& scratch) const;
+
+    int capacity_;
+    std::vector<int> values_;
+    std::vector<int> weights_;
+    std::vector<int> ratioOrder_;         // Razão valor/peso decrescente
+    std::vector<int> rankOf_;             // Posição de cada item em ratioOrder_
+    std::vector<int> minWeightFromRank_;  // Menor peso a partir de cada posição de ratioOrder_
+    std::size_t candidateListSize_;
+    int maxMoves_;
+};
+
+#endif // LOCAL_SEARCH_H
@@ -0,0 +1,41 @@
+#ifndef PHEROMONE_KERNELS_H
+#define PHEROMONE_KERNELS_H
+
+#include <cstddef>  // Para std::size_t
+#include <cstdint>  // Para std::uint64_t
+
+// Conjunto de instruções usado pelos kernels de feromônio
+enum class KernelIsa {
+    Scalar,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+// Kernels que operam sobre os vetores contíguos de feromônio (pegar / não pegar).
+// Todas as versões produzem exatamente os mesmos resultados que a versão escalar:
+// as operações são elemento a elemento, sem reassociação de somas.
+struct PheromoneKernels {
+    // values[i] = max(values[i] * factor, floor); retorna quantas entradas ficaram presas no piso
+    std::size_t (*evaporate)(double* values, std::size_t n, double factor, double floor);
+
+    // Para cada item: take[i] += amount se o bit i de solutionBits estiver ligado,
+    // senão notTake[i] += amount (solutionBits tem 64 itens por palavra, como Solution)
+    void (*deposit)(double* take, double* notTake, const std::uint64_t* solutionBits, std::size_t n, double amount);
+
+    KernelIsa isa;
+    const char* name;
+};
+
+// Kernels para um conjunto de instruções específico (útil para comparar com a versão escalar)
+const PheromoneKernels& pheromoneKernelsFor(KernelIsa isa);
+
+// Melhor conjunto suportado pela CPU, detectado em tempo de execução uma única vez
+const PheromoneKernels& selectPheromoneKernels();
+
+// Entropia binária média de p = take[i] / (take[i] + notTake[i]), em bits por item. Não faz parte
+// dos kernels: é só escalar (dois log2 por item dominam o custo), e o traço de convergência a
+// calcula apenas a cada kTraceEntropyInterval iterações.
+double pheromoneEntropy(const double* take, const double* notTake, std::size_t n);
+
+#endif // PHEROMONE_KERNELS_H
@@ -0,0 +1,43 @@
+#ifndef REDUCTION_H
+#define REDUCTION_H
+
+#include <vector>   // Para std::vector
+#include <cstddef>  // Para std::size_t
+
+#include "utils.h"  // Para Item
+
+// Relaxação linear (limite de Dantzig): itens em ordem decrescente de valor/peso entram
+// inteiros até o item crítico, que entra fracionado. Devolve o valor ótimo da relaxação.
+double dantzigUpperBound(int capacity, const std::vector<Item>& items);
+
+// Redução ao problema núcleo ("core problem").
+// Com o item crítico s e r = p_s / w_s, o custo reduzido de cada item é d_j = p_j - r * w_j,
+// e U - |d_j| limita qualquer solução que contrarie a relaxação no item j. Se esse limite
+// fica abaixo do valor da solução gulosa, o item é fixado no valor da relaxação (dentro ou
+// fora): toda solução tão boa quanto a gulosa, e portanto toda solução ótima, respeita a
+// fixação. Se a gulosa já atinge o limite inteiro, ela é ótima e todos os itens são fixados.
+// O ACO então só decide os itens restantes, com a capacidade que sobrou.
+struct ReducedInstance {
+    int capacity;                    // Capacidade que sobra para o núcleo
+    std::vector<Item> coreItems;     // Itens não fixados (Item::id original preservado)
+    std::vector<int> coreToOriginal; // coreItems[k] é items[coreToOriginal[k]]
+    std::vector<int> fixedIn;        // Índices (na instância original) fixados dentro
+    std::size_t numFixedOut;
+    long long fixedValue;            // Soma dos valores dos itens fixados dentro
+    long long fixedWeight;
+    int criticalItem;                // Índice original do item crítico; -1 se todos cabem
+    double upperBound;               // Limite de Dantzig da instância original
+    long long lowerBound;            // Valor da solução gulosa usada na fixação
+};
+
+ReducedInstance reduceInstance(int capacity, const std::vector<Item>& items);
+
+// Mapeia uma solução 0/1 sobre os itens do núcleo para uma solução 0/1 sobre os numItems
+// itens originais, incluindo os fixados dentro
+std::vector<int> expandSolution(const ReducedInstance& reduced, const std::vector<int>& coreSolution,
+                                std::size_t numItems);
+
+// Gap de otimalidade relativo: (limite superior inteiro - valor) / limite superior inteiro
+double optimalityGap(long long value, double upperBound);
+
+#endif // REDUCTION_H
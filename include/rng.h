@@ -0,0 +1,128 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <cstdint>  // Para std::uint64_t
+#include <limits>   // Para std::numeric_limits
+#include <cstddef>  // Para std::size_t
+
+// SplitMix64: avança o estado e devolve um valor bem misturado.
+// Usado para derivar sementes independentes a partir de (seed, iteração, formiga).
+inline std::uint64_t splitMix64(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Quatro geradores xoshiro256** (Blackman & Vigna) independentes avançando juntos, com o estado
+// guardado por palavra (s0 das quatro pistas, depois s1, ...). Os laços sobre as pistas não têm
+// dependência entre si e as multiplicações por 5 e 9 são deslocamentos e somas, então o
+// compilador consegue gerar instruções SIMD mesmo sem multiplicação vetorial de 64 bits. Pensado
+// para preencher blocos inteiros de números de uma vez (fill, fillUniform) em vez de um sorteio
+// por chamada. Estado de 128 bytes, barato de criar: um fluxo independente por formiga em cada
+// iteração. Satisfaz UniformRandomBitGenerator, então funciona com std::shuffle e distribuições.
+class Xoshiro256x4 {
+public:
+    using result_type = std::uint64_t;
+    static constexpr int kLanes = 4;
+
+    explicit Xoshiro256x4(std::uint64_t seed = 0) {
+        std::uint64_t sm = seed;
+        for (int lane = 0; lane < kLanes; ++lane) {
+            for (int word = 0; word < 4; ++word) {
+                s_[word][lane] = splitMix64(sm);
+            }
+        }
+    }
+
+    // Fluxo baseado em contador: o mesmo (seed, iteração, formiga) gera sempre a mesma
+    // sequência, independentemente de qual thread constrói a formiga.
+    static Xoshiro256x4 forStream(unsigned int seed, std::uint64_t iteration, std::uint64_t ant) {
+        std::uint64_t key = seed;
+        std::uint64_t mixed = splitMix64(key);
+        key = mixed ^ iteration;
+        mixed = splitMix64(key);
+        key = mixed ^ ant;
+        return Xoshiro256x4(splitMix64(key));
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // Sorteio avulso, servido a partir de um bloco de quatro (usado nas rejeições de boundedRandom)
+    result_type operator()() {
+        if (pending_ == kLanes) {
+            nextBlock(block_);
+            pending_ = 0;
+        }
+        return block_[pending_++];
+    }
+
+    // Preenche out com count palavras de 64 bits. Um bloco final incompleto é descartado
+    // por inteiro, então a sequência depende só de count.
+    void fill(std::uint64_t* out, std::size_t count) {
+        std::size_t i = 0;
+        for (; i + kLanes <= count; i += kLanes) {
+            nextBlock(out + i);
+        }
+        if (i < count) {
+            std::uint64_t tail[kLanes];
+            nextBlock(tail);
+            for (std::size_t lane = 0; i + lane < count; ++lane) {
+                out[i + lane] = tail[lane];
+            }
+        }
+    }
+
+    // Preenche out com count doubles uniformes em [0, 1), usando os 53 bits mais altos
+    void fillUniform(double* out, std::size_t count) {
+        std::uint64_t block[kLanes];
+        for (std::size_t i = 0; i < count; i += kLanes) {
+            nextBlock(block);
+            std::size_t lanes = (count - i < static_cast<std::size_t>(kLanes)) ? count - i : kLanes;
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                out[i + lane] = static_cast<double>(block[lane] >> 11) * 0x1.0p-53;
+            }
+        }
+    }
+
+private:
+    void nextBlock(std::uint64_t* out) {
+        for (int lane = 0; lane < kLanes; ++lane) {
+            const std::uint64_t x = s_[1][lane];
+            const std::uint64_t times5 = (x << 2) + x;
+            const std::uint64_t rotated = (times5 << 7) | (times5 >> 57);
+            out[lane] = (rotated << 3) + rotated;  // * 9
+            const std::uint64_t t = x << 17;
+            s_[2][lane] ^= s_[0][lane];
+            s_[3][lane] ^= s_[1][lane];
+            s_[1][lane] ^= s_[2][lane];
+            s_[0][lane] ^= s_[3][lane];
+            s_[2][lane] ^= t;
+            s_[3][lane] = (s_[3][lane] << 45) | (s_[3][lane] >> 19);
+        }
+    }
+
+    std::uint64_t s_[4][kLanes];
+    std::uint64_t block_[kLanes] = {};
+    int pending_ = kLanes;
+};
+
+// Inteiro uniforme em [0, range) a partir de uma palavra de 64 bits já sorteada, pelo método de
+// Lemire (multiplicação em vez de divisão; a divisão só acontece no caso raro de rejeição).
+// Usa os 32 bits altos de word, então range precisa caber em 32 bits.
+template <class Rng>
+inline std::uint32_t boundedRandom(std::uint64_t word, std::uint32_t range, Rng& rng) {
+    std::uint64_t product = (word >> 32) * static_cast<std::uint64_t>(range);
+    std::uint32_t low = static_cast<std::uint32_t>(product);
+    if (low < range) {
+        const std::uint32_t threshold = static_cast<std::uint32_t>(-range) % range;
+        while (low < threshold) {
+            product = (rng() >> 32) * static_cast<std::uint64_t>(range);
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+    return static_cast<std::uint32_t>(product >> 32);
+}
+
+#endif // RNG_H
@@ -0,0 +1,33 @@
+#ifndef RUN_SCHEDULER_H
+#define RUN_SCHEDULER_H
+
+#include <vector>      // Para std::vector
+#include <functional>  // Para std::function
+
+// Tempo medido para uma execução individual
+struct RunTiming {
+    double wallSeconds;  // Tempo de relógio
+    double cpuSeconds;   // Tempo de CPU consumido pela thread que executou
+};
+
+// Distribui execuções independentes (por exemplo, seeds diferentes do ACO) entre
+// várias threads usando roubo de trabalho. Cada thread começa com uma faixa contígua
+// de execuções e, quando a esvazia, rouba metade da faixa restante de outra thread.
+// As faixas são palavras atômicas de 64 bits, então o escalonamento não usa mutex.
+class RunScheduler {
+public:
+    // numThreads <= 0 usa std::thread::hardware_concurrency()
+    explicit RunScheduler(int numThreads = 0);
+
+    // Executa job(indice) para indice em [0, numRuns) e retorna o tempo de cada execução,
+    // na ordem dos índices. O job deve gravar seu resultado numa posição própria
+    // (por exemplo, resultados[indice]), o que dispensa qualquer lock na coleta.
+    std::vector<RunTiming> run(int numRuns, const std::function<void(int)>& job) const;
+
+    int numThreads() const;
+
+private:
+    int numThreads_;
+};
+
+#endif // RUN_SCHEDULER_H
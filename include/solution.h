@@ -0,0 +1,121 @@
+#ifndef SOLUTION_H
+#define SOLUTION_H
+
+#include <vector>   // Para std::vector
+#include <cstdint>  // Para std::uint64_t
+#include <cstddef>  // Para std::size_t
+
+// Chave de Zobrist do item i: um valor pseudoaleatório fixo de 64 bits por índice (finalizador
+// do SplitMix64), calculado na hora em vez de lido de uma tabela
+inline std::uint64_t zobristKey(std::size_t i) {
+    std::uint64_t z = (static_cast<std::uint64_t>(i) + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Solução da mochila compacta: um bit por item (64 itens por palavra) e os totais
+// de valor e peso mantidos de forma incremental, sem precisar reescanear os itens.
+// A impressão digital (XOR das chaves de Zobrist dos itens incluídos) também é incremental.
+class Solution {
+public:
+    Solution() : numItems_(0), value_(0), weight_(0), fingerprint_(0) {}
+
+    explicit Solution(std::size_t numItems) : Solution() {
+        reset(numItems);
+    }
+
+    // Esvazia a solução para numItems itens (reaproveita a memória já alocada)
+    void reset(std::size_t numItems) {
+        numItems_ = numItems;
+        words_.assign((numItems + 63) / 64, 0);
+        value_ = 0;
+        weight_ = 0;
+        fingerprint_ = 0;
+    }
+
+    std::size_t size() const { return numItems_; }
+
+    bool test(std::size_t i) const {
+        return (words_[i >> 6] >> (i & 63)) & 1ULL;
+    }
+
+    // Inclui o item i (que não pode já estar incluído) e atualiza os totais
+    void add(std::size_t i, long long itemValue, long long itemWeight) {
+        words_[i >> 6] |= (1ULL << (i & 63));
+        value_ += itemValue;
+        weight_ += itemWeight;
+        fingerprint_ ^= zobristKey(i);
+    }
+
+    // Remove o item i (que precisa estar incluído) e atualiza os totais
+    void remove(std::size_t i, long long itemValue, long long itemWeight) {
+        words_[i >> 6] &= ~(1ULL << (i & 63));
+        value_ -= itemValue;
+        weight_ -= itemWeight;
+        fingerprint_ ^= zobristKey(i);
+    }
+
+    long long value() const { return value_; }
+    long long weight() const { return weight_; }
+
+    // Hash de 64 bits do conjunto de itens: soluções iguais têm a mesma impressão digital
+    std::uint64_t fingerprint() const { return fingerprint_; }
+
+    // Número de itens incluídos (popcount por palavra)
+    std::size_t count() const {
+        std::size_t total = 0;
+        for (std::uint64_t w : words_) {
+            total += static_cast<std::size_t>(__builtin_popcountll(w));
+        }
+        return total;
+    }
+
+    const std::uint64_t* words() const { return words_.data(); }
+    std::size_t numWords() const { return words_.size(); }
+
+    // Chama f(indice) para cada item incluído, em ordem crescente de índice
+    template <typename F>
+    void forEachSetBit(F f) const {
+        for (std::size_t w = 0; w < words_.size(); ++w) {
+            std::uint64_t bits = words_[w];
+            while (bits != 0) {
+                f(w * 64 + static_cast<std::size_t>(__builtin_ctzll(bits)));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    // Representação 0/1 por item, usada na interface pública do ACO e nos relatórios
+    std::vector<int> toVector() const {
+        std::vector<int> result(numItems_, 0);
+        forEachSetBit([&](std::size_t i) { result[i] = 1; });
+        return result;
+    }
+
+    bool operator==(const Solution& other) const {
+        return numItems_ == other.numItems_ && words_ == other.words_;
+    }
+
+    // Mesma ordem da comparação lexicográfica dos vetores 0/1 equivalentes
+    // (o primeiro item em que diferem decide; quem contém o item é maior)
+    bool operator<(const Solution& other) const {
+        std::size_t n = words_.size() < other.words_.size() ? words_.size() : other.words_.size();
+        for (std::size_t w = 0; w < n; ++w) {
+            std::uint64_t diff = words_[w] ^ other.words_[w];
+            if (diff != 0) {
+                return (other.words_[w] >> __builtin_ctzll(diff)) & 1ULL;
+            }
+        }
+        return numItems_ < other.numItems_;
+    }
+
+private:
+    std::vector<std::uint64_t> words_;
+    std::size_t numItems_;
+    long long value_;
+    long long weight_;
+    std::uint64_t fingerprint_;
+};
+
+#endif // SOLUTION_H
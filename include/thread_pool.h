@@ -0,0 +1,47 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>              // Para std::vector
+#include <thread>              // Para std::thread
+#include <mutex>               // Para std::mutex
+#include <condition_variable>  // Para std::condition_variable
+#include <atomic>              // Para std::atomic
+#include <functional>          // Para std::function
+
+// Pool persistente de threads para laços paralelos do tipo "parallel for".
+// As threads são criadas uma única vez e reutilizadas em todas as chamadas,
+// evitando o custo de criar threads a cada iteração do ACO.
+class ThreadPool {
+public:
+    // numThreads inclui a thread chamadora; com 1 thread tudo roda de forma serial.
+    explicit ThreadPool(int numThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Executa task(indice, worker) para indice em [0, count) e bloqueia até todas terminarem.
+    // worker identifica a thread (0 = chamadora) e pode indexar áreas de rascunho por thread.
+    void parallelFor(int count, const std::function<void(int, int)>& task);
+
+    int size() const;
+
+private:
+    void workerLoop(int worker);
+    void runTasks(int worker);
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wakeWorkers_;
+    std::condition_variable workDone_;
+
+    // Estado do lote atual (protegido por mutex_, exceto os contadores atômicos)
+    const std::function<void(int, int)>* task_;
+    int taskCount_;
+    std::atomic<int> nextTask_;
+    int activeWorkers_;
+    unsigned long generation_;
+    bool stopping_;
+};
+
+#endif // THREAD_POOL_H
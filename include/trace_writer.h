@@ -0,0 +1,116 @@
+#ifndef TRACE_WRITER_H
+#define TRACE_WRITER_H
+
+#include <cstdint>  // Para std::uint32_t, std::int32_t, std::uint64_t
+#include <cstddef>  // Para std::size_t
+#include <string>   // Para std::string
+#include <vector>   // Para std::vector
+#include <atomic>   // Para std::atomic
+#include <thread>   // Para std::thread
+#include <memory>   // Para std::unique_ptr
+#include <fstream>  // Para std::ofstream
+
+// Uma linha do traço de convergência: uma iteração de uma execução
+struct TraceRecord {
+    std::uint32_t run;
+    std::uint32_t iteration;   // Iterações concluídas (1, 2, ...)
+    std::int32_t bestValue;    // Melhor formiga viável da iteração (0 se nenhuma)
+    std::int32_t worstValue;   // Pior formiga viável da iteração (0 se nenhuma)
+    std::int32_t bestSoFar;    // Melhor valor desde o início de solve()
+    double meanValue;          // Média das formigas viáveis da iteração
+    double entropy;            // Entropia média do feromônio, em bits por item (1 = uniforme, 0 = convergido);
+                               // NaN nas iterações em que não foi medida (ver kTraceEntropyInterval)
+    double elapsedSeconds;     // Desde o início de solve()
+};
+
+// A entropia custa dois log2 por item na thread de solve(); ela é medida só nas iterações
+// 1, 1 + kTraceEntropyInterval, 1 + 2 * kTraceEntropyInterval, ...
+constexpr std::uint32_t kTraceEntropyInterval = 16;
+
+// --- Formato do arquivo de traço (little-endian) ---
+// Cabeçalho, numColumns descritores e uma sequência de blocos. Cada bloco tem rowCount e depois
+// as colunas uma após a outra (rowCount valores da primeira, rowCount da segunda, ...), de modo
+// que o leitor carrega cada coluna com uma única cópia (traco_aco.py faz isso com numpy).
+struct TraceFileHeader {
+    char magic[8];              // "ACOTRC01"
+    std::uint32_t version;      // 1
+    std::uint32_t numColumns;
+};
+
+struct TraceColumnDescriptor {
+    char name[16];              // Terminado em zero
+    char type;                  // 'u' (sem sinal), 'i' (inteiro) ou 'f' (ponto flutuante)
+    std::uint8_t size;          // Bytes por valor
+    std::uint8_t reserved[6];
+};
+
+struct TraceBlockHeader {
+    std::uint32_t rowCount;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(TraceFileHeader) == 16, "cabeçalho do traço com layout fixo");
+static_assert(sizeof(TraceColumnDescriptor) == 24, "descritor de coluna com layout fixo");
+
+// Gravador assíncrono do traço. As threads de solve() chamam record(), que só copia o registro
+// para um anel circular sem lock (fila limitada de Vyukov, vários produtores); uma thread de
+// fundo esvazia o anel, monta os blocos colunares e escreve no arquivo. record() nunca bloqueia
+// nem aloca: com o anel cheio o registro é descartado e contado em dropped().
+class TraceWriter {
+public:
+    TraceWriter();
+    ~TraceWriter();
+
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+
+    // Cria o arquivo, grava o cabeçalho e inicia a thread de escrita. ringCapacity é arredondado
+    // para cima até uma potência de 2. Em caso de falha preenche error e retorna false.
+    bool open(const std::string& filePath, std::string& error, std::size_t ringCapacity = 1 << 14);
+
+    // Seguro para chamar de várias threads ao mesmo tempo; devolve false se descartou
+    bool record(const TraceRecord& record);
+
+    // Esvazia o anel, grava o último bloco e encerra a thread de escrita. Só depois que todas as
+    // execuções pararam de chamar record(). Também chamado pelo destrutor.
+    void close();
+
+    std::uint64_t written() const;
+    std::uint64_t dropped() const;
+
+private:
+    struct Cell {
+        std::atomic<std::uint64_t> sequence;
+        TraceRecord record;
+    };
+
+    static constexpr std::size_t kBlockRows = 4096;
+    static constexpr int kSleepMilliseconds = 20;  // Intervalo entre passadas da thread de escrita
+
+    bool pop(TraceRecord& record);
+    void writerLoop();
+    void appendRow(const TraceRecord& record);
+    void flushBlock();
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_;
+    alignas(64) std::atomic<std::uint64_t> enqueuePosition_;  // Disputada pelos produtores
+    alignas(64) std::uint64_t dequeuePosition_;               // Só a thread de escrita usa
+    std::atomic<bool> stopping_;
+    std::atomic<std::uint64_t> written_;
+    std::atomic<std::uint64_t> dropped_;
+    std::thread writer_;
+    std::ofstream file_;
+
+    // Bloco em montagem, uma coluna por campo de TraceRecord (só a thread de escrita usa)
+    std::vector<std::uint32_t> runColumn_;
+    std::vector<std::uint32_t> iterationColumn_;
+    std::vector<std::int32_t> bestColumn_;
+    std::vector<std::int32_t> worstColumn_;
+    std::vector<std::int32_t> bestSoFarColumn_;
+    std::vector<double> meanColumn_;
+    std::vector<double> entropyColumn_;
+    std::vector<double> elapsedColumn_;
+};
+
+#endif // TRACE_WRITER_H
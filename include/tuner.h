@@ -0,0 +1,94 @@
+#ifndef TUNER_H
+#define TUNER_H
+
+#include <vector>   // Para std::vector
+#include <string>   // Para std::string
+#include <iosfwd>   // Para std::ostream
+
+#include "utils.h"  // Para Item
+
+// Ajuste automático dos parâmetros do ACO por corrida (F-race, Birattari et al.; o mesmo
+// procedimento que o irace repete a cada iteração). Um conjunto de configurações candidatas é
+// avaliado bloco a bloco, onde um bloco é um par (instância de treino, seed) e todas as
+// candidatas vivas rodam nele com a mesma seed. Depois de minBlocks blocos, o teste de Friedman
+// sobre os postos dentro de cada bloco decide se há diferença; havendo, a comparação múltipla
+// associada elimina as candidatas significativamente piores que a de menor soma de postos.
+// Cada rodada de blocos roda em paralelo em todos os núcleos (uma execução do ACO por tarefa).
+
+// Um ponto do espaço de parâmetros
+struct ParameterConfig {
+    int numAnts;
+    double evaporationRate;
+    double alpha;
+    double beta;
+};
+
+// Instância de treino (vinda de arquivo ou gerada por classe)
+struct TuningInstance {
+    std::string name;
+    int capacity;
+    std::vector<Item> items;
+};
+
+struct TunerConfig {
+    int numConfigurations = 48;      // Candidatas sorteadas da grade (a configuração base é sempre incluída)
+    long long evaluationBudget = 2000;  // Execuções do ACO durante a corrida
+    int antEvaluations = 20000;      // Soluções construídas por execução: iterações = antEvaluations / numAnts
+    int minBlocks = 5;               // Blocos antes do primeiro teste
+    double confidence = 0.95;        // Nível dos testes de Friedman e da comparação múltipla
+    int validationRuns = 10;         // Execuções por instância na validação final
+    int numThreads = 0;              // <= 0 usa std::thread::hardware_concurrency()
+    unsigned int seed = 12345;
+    ParameterConfig baseline = {50, 0.3, 1.5, 2.5};  // Configuração atual de main(), sempre candidata
+};
+
+// Distribuição de uma configuração nas execuções de validação. A qualidade de cada execução é
+// valor / referência, com a referência sendo o melhor valor que qualquer candidata encontrou
+// naquela instância durante a corrida; o tempo até o alvo é medido com a referência como alvo.
+struct ValidationStats {
+    int runs = 0;
+    double qualityMin = 0.0;
+    double qualityP10 = 0.0;
+    double qualityMedian = 0.0;
+    double qualityMean = 0.0;
+    double qualityMax = 0.0;
+    double targetHitRate = 0.0;       // Fração das execuções que atingiram a referência
+    double timeToTargetMedian = 0.0;  // Segundos, só entre as execuções que atingiram (0 se nenhuma)
+    double timeToTargetP90 = 0.0;
+    double iterationsToTargetMedian = 0.0;
+};
+
+struct TuningResult {
+    ParameterConfig best;
+    std::vector<ParameterConfig> survivors;  // Vivas ao fim, da melhor soma de postos para a pior
+    int candidates = 0;
+    int blocks = 0;
+    long long evaluations = 0;
+    double raceSeconds = 0.0;
+    ValidationStats bestStats;
+    ValidationStats baselineStats;
+};
+
+// Teste de Friedman na forma de Conover seguido da comparação múltipla contra a candidata de
+// menor soma de postos. values[c][bloco] é o valor da candidata c no bloco (maior é melhor);
+// só as candidatas em alive e os blocos [0, blocks) entram.
+struct FriedmanOutcome {
+    double statistic = 0.0;           // T de Conover (0 se todas empataram em todos os blocos)
+    double criticalDifference = 0.0;  // Acima desta diferença de soma de postos a candidata sai (0 se T não rejeitou)
+    std::vector<double> rankSums;     // Uma por posição em alive; posto 1 = maior valor no bloco
+    std::vector<int> discarded;       // Posições em alive que devem sair, em ordem crescente
+};
+
+FriedmanOutcome friedmanConover(const std::vector<std::vector<int>>& values, const std::vector<int>& alive,
+                                int blocks, double confidence);
+
+// Roda a corrida e a validação; log recebe uma linha por rodada com eliminações
+TuningResult raceParameters(const std::vector<TuningInstance>& instances, const TunerConfig& config,
+                            std::ostream& log);
+
+// Instâncias de treino a partir de uma lista separada por vírgulas. Cada entrada é um arquivo
+// (texto ou binário) ou "classe:n[:k]", que gera k (padrão 4) instâncias da classe com n itens.
+bool loadTuningInstances(const std::string& list, unsigned int seed, std::vector<TuningInstance>& instances,
+                         std::string& error);
+
+#endif // TUNER_H
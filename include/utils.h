@@ -6,6 +6,8 @@
 #include <utility> // Para std::pair
 #include <fstream>
 #include <iostream>
+#include <cstdint>
+#include <cstddef>
 
 struct Item {
     int id;
@@ -13,7 +15,64 @@ struct Item {
     int weight;
 };
 
-// A função de leitura da instância
+// --- Formato binário de instância ---
+// Cabeçalho seguido de numItems registros com o mesmo layout de Item (id, valor, peso em int32),
+// de modo que o arquivo mapeado pode ser usado diretamente como um vetor de Item.
+struct BinaryInstanceHeader {
+    char magic[8];             // "ACOKNAP1"
+    std::uint32_t version;     // 1
+    std::uint32_t recordSize;  // sizeof(Item)
+    std::uint64_t numItems;
+    std::int64_t capacity;
+    std::int64_t totalValue;   // Soma dos valores (64 bits, não transborda)
+    std::int64_t totalWeight;  // Soma dos pesos
+};
+
+static_assert(sizeof(Item) == 12, "o formato binário assume Item com três int32");
+static_assert(sizeof(BinaryInstanceHeader) == 48, "cabeçalho binário com layout fixo");
+
+// Instância binária mapeada em memória (somente leitura, sem cópia nem parsing)
+class MappedInstance {
+public:
+    MappedInstance();
+    ~MappedInstance();
+
+    MappedInstance(const MappedInstance&) = delete;
+    MappedInstance& operator=(const MappedInstance&) = delete;
+
+    // Mapeia o arquivo e valida o cabeçalho; em caso de falha preenche error e retorna false
+    bool open(const std::string& filePath, std::string& error);
+
+    const BinaryInstanceHeader& header() const;
+    int capacity() const;
+    std::size_t numItems() const;
+    const Item* items() const;  // Aponta diretamente para os registros mapeados
+
+private:
+    void close();
+
+    void* data_;
+    std::size_t size_;
+};
+
+// A função de leitura da instância.
+// Aceita o formato texto (número de itens, capacidade e pares "valor peso") ou o binário,
+// detectado pelo cabeçalho. Valores e pesos precisam ser >= 0 nos dois formatos; no binário os
+// totais do cabeçalho têm de bater com os itens e os ids não podem se repetir. Em caso de erro
+// imprime a causa em std::cerr e retorna {0, {}}.
 std::pair<int, std::vector<Item>> readKnapsackInstance(const std::string& filePath);
 
-#endif // UTILS_H
\ No newline at end of file
+// Mesma leitura, mas devolvendo o erro (com número de linha, no formato texto) em vez de imprimi-lo
+bool loadKnapsackInstance(const std::string& filePath, int& capacity, std::vector<Item>& items,
+                          std::string& error);
+
+// Escrita nos dois formatos
+bool writeTextInstance(const std::string& filePath, int capacity, const std::vector<Item>& items,
+                       std::string& error);
+bool writeBinaryInstance(const std::string& filePath, int capacity, const std::vector<Item>& items,
+                         std::string& error);
+
+// Converte entre os formatos: uma entrada texto vira binária e uma entrada binária vira texto
+bool convertInstance(const std::string& inputPath, const std::string& outputPath, std::string& error);
+
+#endif // UTILS_H
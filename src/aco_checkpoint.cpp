@@ -0,0 +1,100 @@
+#include "aco_checkpoint.h"
+#include <fstream>
+#include <cstring>
+
+namespace {
+
+const char kCheckpointMagic[8] = {'A', 'C', 'O', 'C', 'K', 'P', 'T', '1'};
+
+template <typename T>
+void writeVector(std::ofstream& file, const std::vector<T>& values) {
+    file.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+template <typename T>
+bool readVector(std::ifstream& file, std::vector<T>& values, std::uint64_t count) {
+    values.resize(count);
+    file.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(count * sizeof(T)));
+    return static_cast<bool>(file);
+}
+
+} // namespace
+
+bool writeCheckpoint(const std::string& filePath, const AcoCheckpoint& checkpoint, std::string& error) {
+    if (checkpoint.take.size() != checkpoint.itemIds.size() || checkpoint.notTake.size() != checkpoint.itemIds.size()) {
+        error = "Checkpoint inconsistente: vetores de feromônio e de ids com tamanhos diferentes";
+        return false;
+    }
+
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        error = "Erro ao abrir o arquivo para escrita: " + filePath;
+        return false;
+    }
+
+    CheckpointHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kCheckpointMagic, sizeof(kCheckpointMagic));
+    header.version = 1;
+    header.seed = checkpoint.seed;
+    header.numItems = checkpoint.itemIds.size();
+    header.numBestItems = checkpoint.bestItemIds.size();
+    header.iterations = checkpoint.iterations;
+    header.capacity = checkpoint.capacity;
+    header.bestValue = checkpoint.bestValue;
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeVector(file, checkpoint.itemIds);
+    writeVector(file, checkpoint.take);
+    writeVector(file, checkpoint.notTake);
+    writeVector(file, checkpoint.bestItemIds);
+
+    if (!file) {
+        error = "Erro ao escrever o arquivo: " + filePath;
+        return false;
+    }
+    return true;
+}
+
+bool readCheckpoint(const std::string& filePath, AcoCheckpoint& checkpoint, std::string& error) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        error = "Erro ao abrir o arquivo: " + filePath;
+        return false;
+    }
+
+    CheckpointHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        error = "Checkpoint truncado (cabeçalho incompleto): " + filePath;
+        return false;
+    }
+    if (std::memcmp(header.magic, kCheckpointMagic, sizeof(kCheckpointMagic)) != 0 || header.version != 1) {
+        error = "Arquivo não é um checkpoint do ACO (versão 1): " + filePath;
+        return false;
+    }
+
+    // Confere os tamanhos declarados contra o arquivo antes de alocar qualquer coisa
+    std::streamoff headerEnd = file.tellg();
+    file.seekg(0, std::ios::end);
+    std::uint64_t payload = static_cast<std::uint64_t>(file.tellg() - headerEnd);
+    file.seekg(headerEnd);
+    const std::uint64_t perItem = sizeof(int) + 2 * sizeof(double);
+    if (header.numItems > payload / perItem ||
+        header.numBestItems != (payload - header.numItems * perItem) / sizeof(int) ||
+        (payload - header.numItems * perItem) % sizeof(int) != 0) {
+        error = "Checkpoint com tamanho inconsistente com o cabeçalho: " + filePath;
+        return false;
+    }
+
+    checkpoint.capacity = static_cast<int>(header.capacity);
+    checkpoint.seed = header.seed;
+    checkpoint.iterations = header.iterations;
+    checkpoint.bestValue = header.bestValue;
+    if (!readVector(file, checkpoint.itemIds, header.numItems) || !readVector(file, checkpoint.take, header.numItems) ||
+        !readVector(file, checkpoint.notTake, header.numItems) ||
+        !readVector(file, checkpoint.bestItemIds, header.numBestItems)) {
+        error = "Checkpoint truncado: " + filePath;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,8 @@
+#include "aco_variants.h"
+#include "aco_engine_impl.h"
+
+template class ACOEngine<AntSystemUpdate, RatioHeuristic, int, RuntimeExponent, RuntimeExponent>;
+template class ACOEngine<ElitistUpdate<5>, RatioHeuristic, int, RuntimeExponent, RuntimeExponent>;
+template class ACOEngine<RankBasedUpdate<6>, RatioHeuristic, int, RuntimeExponent, RuntimeExponent>;
+template class ACOEngine<MaxMinUpdate<50>, RatioHeuristic, int, RuntimeExponent, RuntimeExponent>;
+template class ACOEngine<TopRankUpdate<5>, RatioHeuristic, int, HalfIntegerExponent<3>, HalfIntegerExponent<5>>;
@@ -0,0 +1,301 @@
+#include "batch_solver.h"
+#include "aco.h"
+#include "exact_solver.h"
+#include "bounded_queue.h"
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Texto entre aspas no JSON, escapando só o que pode aparecer num id ou numa mensagem de erro
+std::string jsonString(const std::string& text) {
+    std::string out = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += (c == '\n' || c == '\t') ? ' ' : c;
+    }
+    return out + "\"";
+}
+
+// Itens "v:p,v:p,..." com ids na ordem em que aparecem
+bool parseInlineItems(const std::string& text, std::vector<Item>& items) {
+    items.clear();
+    std::stringstream ss(text);
+    std::string pair;
+    while (std::getline(ss, pair, ',')) {
+        std::size_t colon = pair.find(':');
+        if (colon == std::string::npos) {
+            return false;
+        }
+        Item item;
+        item.id = static_cast<int>(items.size());
+        item.value = std::stoi(pair.substr(0, colon));
+        item.weight = std::stoi(pair.substr(colon + 1));
+        if (item.weight <= 0 || item.value < 0) {
+            return false;
+        }
+        items.push_back(item);
+    }
+    return !items.empty();
+}
+
+// Ids dos itens escolhidos separados por vírgula; weight recebe o peso total
+std::string chosenItems(const std::vector<int>& solution, const std::vector<Item>& items, long long& weight) {
+    std::ostringstream chosen;
+    const char* separator = "";
+    weight = 0;
+    for (std::size_t i = 0; i < solution.size(); ++i) {
+        if (solution[i] == 1) {
+            chosen << separator << items[i].id;
+            separator = ",";
+            weight += items[i].weight;
+        }
+    }
+    return chosen.str();
+}
+
+// Percentil pelo posto mais próximo sobre latências já ordenadas
+double percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    std::size_t rank = static_cast<std::size_t>(fraction * sorted.size() + 0.999999);
+    return sorted[std::min(std::max<std::size_t>(rank, 1), sorted.size()) - 1];
+}
+
+// Estado compartilhado entre a leitura e as threads de trabalho
+struct BatchState {
+    BatchState(std::ostream& out, const BatchConfig& batchConfig)
+        : output(out), config(batchConfig), queue(batchConfig.queueCapacity) {}
+
+    std::ostream& output;
+    const BatchConfig& config;
+    BoundedQueue<BatchJob> queue;
+    std::mutex outputMutex;  // Protege output e os contadores abaixo
+    std::vector<double> latencies;
+    long long solved = 0;
+    long long expired = 0;
+    long long failed = 0;
+
+    // Escreve uma linha de resultado inteira de uma vez e registra a latência da tarefa
+    void emit(const std::string& line, std::chrono::steady_clock::time_point received, long long BatchState::*counter) {
+        double latency = secondsSince(received);
+        std::lock_guard<std::mutex> lock(outputMutex);
+        output << line << ",\"latencia_s\":" << latency << "}\n";
+        output.flush();
+        latencies.push_back(latency);
+        ++(this->*counter);
+    }
+};
+
+// Uma thread de trabalho: o ACO e o vetor de itens sobrevivem de uma tarefa para a outra
+void workerLoop(BatchState& state) {
+    std::unique_ptr<ACO> aco;
+    std::vector<Item> fileItems;
+    BatchJob job;
+
+    while (state.queue.pop(job)) {
+        double waited = secondsSince(job.received);
+        std::ostringstream line;
+        line << "{\"id\":" << jsonString(job.id) << ",\"espera_s\":" << waited;
+
+        if (job.deadlineSeconds > 0.0 && waited >= job.deadlineSeconds) {
+            line << ",\"status\":\"expirado\"";
+            state.emit(line.str(), job.received, &BatchState::expired);
+            continue;
+        }
+
+        int capacity = job.capacity;
+        const std::vector<Item>* items = &job.items;
+        if (!job.instancePath.empty()) {
+            std::string error;
+            if (!loadKnapsackInstance(job.instancePath, capacity, fileItems, error)) {
+                line << ",\"status\":\"erro\",\"mensagem\":" << jsonString(error);
+                state.emit(line.str(), job.received, &BatchState::failed);
+                continue;
+            }
+            items = &fileItems;
+        }
+
+        if (state.config.useExactFastPath &&
+            exactFastPathApplies(capacity, items->size(), static_cast<long long>(job.numAnts) * job.maxIterations)) {
+            ExactResult exact = solveByDynamicProgramming(capacity, *items, true);
+            long long weight = 0;
+            std::string chosen = chosenItems(exact.solution, *items, weight);
+            line << ",\"status\":\"ok\",\"melhor_valor\":" << exact.value << ",\"peso\":" << weight
+                 << ",\"capacidade\":" << capacity << ",\"iteracoes\":0,\"parada\":\"exato\""
+                 << ",\"solucao_s\":" << exact.seconds << ",\"itens\":[" << chosen << "]";
+            state.emit(line.str(), job.received, &BatchState::solved);
+            continue;
+        }
+
+        // Threads e áreas de trabalho do ACO são criadas na primeira tarefa e reaproveitadas depois
+        if (!aco) {
+            aco.reset(new ACO(job.numAnts, job.evaporationRate, job.alpha, job.beta, capacity, *items,
+                              job.maxIterations, job.seed));
+        } else {
+            aco->reset(job.numAnts, job.evaporationRate, job.alpha, job.beta, capacity, *items,
+                       job.maxIterations, job.seed);
+        }
+
+        SolveLimits limits;
+        limits.targetValue = job.targetValue;
+        if (job.deadlineSeconds > 0.0) {
+            // Orçamento zero significaria "sem limite": o que sobrou do prazo nunca passa de um mínimo
+            limits.timeBudgetSeconds = std::max(job.deadlineSeconds - secondsSince(job.received), 1e-6);
+        }
+        SolveResult result = aco->solve(limits);
+
+        long long weight = 0;
+        std::string chosen = chosenItems(result.solution, *items, weight);
+        line << ",\"status\":\"ok\",\"melhor_valor\":" << result.bestValue << ",\"peso\":" << weight
+             << ",\"capacidade\":" << capacity << ",\"iteracoes\":" << result.iterations
+             << ",\"parada\":\"" << stopReasonName(result.stopReason) << "\""
+             << ",\"solucao_s\":" << result.elapsedSeconds << ",\"itens\":[" << chosen << "]";
+        state.emit(line.str(), job.received, &BatchState::solved);
+    }
+}
+
+} // namespace
+
+bool parseBatchJob(const std::string& line, const BatchConfig& defaults, BatchJob& job, std::string& error) {
+    job = BatchJob();
+    job.numAnts = defaults.numAnts;
+    job.maxIterations = defaults.maxIterations;
+    job.evaporationRate = defaults.evaporationRate;
+    job.alpha = defaults.alpha;
+    job.beta = defaults.beta;
+    job.seed = defaults.seed;
+    job.received = std::chrono::steady_clock::now();
+
+    std::istringstream tokens(line);
+    std::string token;
+    bool hasCapacity = false;
+    try {
+        while (tokens >> token) {
+            std::size_t equals = token.find('=');
+            if (equals == std::string::npos || equals == 0) {
+                error = "Esperado chave=valor: " + token;
+                return false;
+            }
+            std::string key = token.substr(0, equals);
+            std::string value = token.substr(equals + 1);
+            if (key == "id") {
+                job.id = value;
+            } else if (key == "instancia") {
+                job.instancePath = value;
+            } else if (key == "capacidade") {
+                job.capacity = std::stoi(value);
+                hasCapacity = true;
+            } else if (key == "itens") {
+                if (!parseInlineItems(value, job.items)) {
+                    error = "Itens inválidos (esperado valor:peso,...): " + value;
+                    return false;
+                }
+            } else if (key == "formigas") {
+                job.numAnts = std::stoi(value);
+            } else if (key == "iteracoes") {
+                job.maxIterations = std::stoi(value);
+            } else if (key == "evaporacao") {
+                job.evaporationRate = std::stod(value);
+            } else if (key == "alfa") {
+                job.alpha = std::stod(value);
+            } else if (key == "beta") {
+                job.beta = std::stod(value);
+            } else if (key == "seed") {
+                job.seed = static_cast<unsigned int>(std::stoul(value));
+            } else if (key == "prazo") {
+                job.deadlineSeconds = std::stod(value);
+            } else if (key == "alvo") {
+                job.targetValue = std::stoi(value);
+            } else {
+                error = "Chave desconhecida: " + key;
+                return false;
+            }
+        }
+    } catch (const std::exception&) {
+        error = "Valor numérico inválido em: " + token;
+        return false;
+    }
+
+    if (job.instancePath.empty() == job.items.empty()) {
+        error = "Informe exatamente um entre instancia= e itens=";
+        return false;
+    }
+    if (!job.items.empty() && (!hasCapacity || job.capacity <= 0)) {
+        error = "Instância na linha sem capacidade= positiva";
+        return false;
+    }
+    if (job.numAnts <= 0 || job.maxIterations <= 0) {
+        error = "formigas e iteracoes precisam ser positivos";
+        return false;
+    }
+    return true;
+}
+
+BatchSummary runBatch(std::istream& input, std::ostream& output, const BatchConfig& config) {
+    BatchState state(output, config);
+    int numWorkers = config.numWorkers;
+    if (numWorkers <= 0) {
+        numWorkers = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int w = 0; w < numWorkers; ++w) {
+        workers.emplace_back(workerLoop, std::ref(state));
+    }
+
+    // Leitura: push() bloqueia com a fila cheia, então a entrada só avança no ritmo das threads
+    std::string line;
+    long long lineNumber = 0;
+    while (std::getline(input, line)) {
+        ++lineNumber;
+        std::size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') {
+            continue;
+        }
+        BatchJob job;
+        std::string error;
+        if (!parseBatchJob(line, config, job, error)) {
+            std::ostringstream result;
+            result << "{\"id\":" << jsonString(std::to_string(lineNumber)) << ",\"status\":\"erro\",\"mensagem\":"
+                   << jsonString(error);
+            state.emit(result.str(), job.received, &BatchState::failed);
+            continue;
+        }
+        if (job.id.empty()) {
+            job.id = std::to_string(lineNumber);
+        }
+        state.queue.push(std::move(job));
+    }
+    state.queue.close();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    BatchSummary summary;
+    summary.wallSeconds = secondsSince(start);
+    summary.solved = state.solved;
+    summary.expired = state.expired;
+    summary.failed = state.failed;
+    summary.jobs = state.solved + state.expired + state.failed;
+    summary.jobsPerSecond = (summary.wallSeconds > 0.0) ? summary.jobs / summary.wallSeconds : 0.0;
+    std::sort(state.latencies.begin(), state.latencies.end());
+    summary.latencyP50 = percentile(state.latencies, 0.50);
+    summary.latencyP90 = percentile(state.latencies, 0.90);
+    summary.latencyP99 = percentile(state.latencies, 0.99);
+    summary.latencyMax = state.latencies.empty() ? 0.0 : state.latencies.back();
+    return summary;
+}
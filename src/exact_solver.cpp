@@ -0,0 +1,221 @@
+#include "exact_solver.h"
+#include <algorithm>
+#include <numeric>
+#include <chrono>
+#include <cstdint>
+
+namespace {
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+const char* exactMethodName(ExactMethod method) {
+    return (method == ExactMethod::DynamicProgramming) ? "programacao_dinamica" : "branch_and_bound";
+}
+
+ExactResult solveByDynamicProgramming(int capacity, const std::vector<Item>& items, bool reconstruct) {
+    auto start = std::chrono::steady_clock::now();
+    const size_t n = items.size();
+    const size_t width = static_cast<size_t>(std::max(capacity, 0)) + 1;
+    const size_t wordsPerRow = (width + 63) / 64;
+
+    // best[c] = maior valor com capacidade c usando os itens já processados
+    std::vector<long long> best(width, 0);
+    std::vector<std::uint64_t> taken;
+    if (reconstruct) {
+        taken.assign(n * wordsPerRow, 0);
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        const int weight = items[i].weight;
+        const long long value = items[i].value;
+        if (weight < 0 || static_cast<size_t>(weight) >= width) {
+            continue;
+        }
+        std::uint64_t* row = reconstruct ? &taken[i * wordsPerRow] : nullptr;
+        // Capacidade decrescente: cada item é usado no máximo uma vez
+        for (size_t c = width - 1; c >= static_cast<size_t>(weight); --c) {
+            long long candidate = best[c - weight] + value;
+            if (candidate > best[c]) {
+                best[c] = candidate;
+                if (row != nullptr) {
+                    row[c >> 6] |= 1ULL << (c & 63);
+                }
+            }
+            if (c == 0) {
+                break;
+            }
+        }
+    }
+
+    ExactResult result;
+    result.optimal = true;
+    result.value = best[width - 1];
+    result.upperBound = result.value;
+    result.method = ExactMethod::DynamicProgramming;
+    result.nodes = static_cast<long long>(n) * static_cast<long long>(width);
+    if (reconstruct) {
+        // Volta do último item ao primeiro: o bit diz se o item melhorou best[c] naquela etapa
+        result.solution.assign(n, 0);
+        size_t c = width - 1;
+        for (size_t i = n; i-- > 0;) {
+            if ((taken[i * wordsPerRow + (c >> 6)] >> (c & 63)) & 1ULL) {
+                result.solution[i] = 1;
+                c -= items[i].weight;
+            }
+        }
+    }
+    result.seconds = secondsSince(start);
+    return result;
+}
+
+ExactResult solveByBranchAndBound(int capacity, const std::vector<Item>& items,
+                                  long long nodeLimit, double timeLimitSeconds) {
+    auto start = std::chrono::steady_clock::now();
+
+    // Itens que cabem, em ordem decrescente de valor/peso
+    std::vector<int> order;
+    order.reserve(items.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+        if (items[i].weight <= capacity) {
+            order.push_back(static_cast<int>(i));
+        }
+    }
+    std::sort(order.begin(), order.end(), [&items](int a, int b) {
+        bool freeA = (items[a].weight == 0);  // Peso zero na frente, como em reduction.cpp
+        bool freeB = (items[b].weight == 0);
+        if (freeA != freeB) {
+            return freeA;
+        }
+        long long lhs = static_cast<long long>(items[a].value) * items[b].weight;
+        long long rhs = static_cast<long long>(items[b].value) * items[a].weight;
+        return (lhs != rhs) ? lhs > rhs : a < b;
+    });
+    const int n = static_cast<int>(order.size());
+
+    // Somas prefixadas na ordem por razão: o item crítico a partir de k sai de uma busca binária
+    std::vector<long long> prefixWeight(n + 1, 0);
+    std::vector<long long> prefixValue(n + 1, 0);
+    for (int k = 0; k < n; ++k) {
+        prefixWeight[k + 1] = prefixWeight[k] + items[order[k]].weight;
+        prefixValue[k + 1] = prefixValue[k] + items[order[k]].value;
+    }
+
+    // Limite de Dantzig inteiro para os itens k..n-1 com capacidade cap
+    auto upperBoundFrom = [&](int k, long long cap) {
+        int j = static_cast<int>(std::upper_bound(prefixWeight.begin() + k, prefixWeight.end(),
+                                                  prefixWeight[k] + cap) - prefixWeight.begin()) - 1;
+        long long bound = prefixValue[j] - prefixValue[k];
+        if (j < n) {
+            long long remaining = cap - (prefixWeight[j] - prefixWeight[k]);
+            bound += remaining * items[order[j]].value / items[order[j]].weight;
+        }
+        return bound;
+    };
+
+    ExactResult result;
+    result.method = ExactMethod::BranchAndBound;
+    result.nodes = 0;
+    result.upperBound = upperBoundFrom(0, capacity);
+    result.solution.assign(items.size(), 0);
+
+    // Incumbente inicial: a solução gulosa
+    long long bestValue = 0;
+    std::vector<char> bestChoice(n, 0);
+    long long remaining = capacity;
+    for (int k = 0; k < n; ++k) {
+        if (items[order[k]].weight <= remaining) {
+            remaining -= items[order[k]].weight;
+            bestValue += items[order[k]].value;
+            bestChoice[k] = 1;
+        }
+    }
+
+    // Busca em profundidade com pilha explícita (a profundidade chega a n, grande demais para recursão).
+    // stage 0: nó novo; 1: ramo "pega" explorado, falta o ramo "não pega"; 2: concluído
+    struct Frame {
+        int k;
+        long long cap;
+        long long value;
+        int stage;
+    };
+    std::vector<Frame> stack;
+    stack.reserve(n + 1);
+    std::vector<char> choice(n, 0);
+    stack.push_back({0, capacity, 0, 0});
+    bool aborted = false;
+
+    while (!stack.empty()) {
+        Frame frame = stack.back();
+        if (frame.stage == 0) {
+            ++result.nodes;
+            if ((result.nodes & 4095) == 0 &&
+                ((nodeLimit > 0 && result.nodes >= nodeLimit) ||
+                 (timeLimitSeconds > 0.0 && secondsSince(start) >= timeLimitSeconds))) {
+                aborted = true;
+                break;
+            }
+            if (frame.value > bestValue) {
+                bestValue = frame.value;
+                std::copy(choice.begin(), choice.begin() + frame.k, bestChoice.begin());
+                std::fill(bestChoice.begin() + frame.k, bestChoice.end(), 0);
+            }
+            if (frame.k == n || frame.value + upperBoundFrom(frame.k, frame.cap) <= bestValue) {
+                stack.pop_back();
+                continue;
+            }
+            stack.back().stage = 1;
+            const Item& item = items[order[frame.k]];
+            if (item.weight <= frame.cap) {
+                choice[frame.k] = 1;
+                stack.push_back({frame.k + 1, frame.cap - item.weight, frame.value + item.value, 0});
+                continue;
+            }
+        }
+        if (frame.stage <= 1) {
+            stack.back().stage = 2;
+            choice[frame.k] = 0;
+            stack.push_back({frame.k + 1, frame.cap, frame.value, 0});
+            continue;
+        }
+        stack.pop_back();
+    }
+
+    result.optimal = !aborted;
+    result.value = bestValue;
+    if (result.optimal) {
+        result.upperBound = bestValue;
+    }
+    for (int k = 0; k < n; ++k) {
+        if (bestChoice[k]) {
+            result.solution[order[k]] = 1;
+        }
+    }
+    result.seconds = secondsSince(start);
+    return result;
+}
+
+long long dynamicProgrammingBytes(int capacity, std::size_t numItems, bool reconstruct) {
+    const long long width = static_cast<long long>(std::max(capacity, 0)) + 1;
+    long long bytes = width * static_cast<long long>(sizeof(long long));
+    if (reconstruct) {
+        bytes += static_cast<long long>(numItems) * ((width + 63) / 64) * static_cast<long long>(sizeof(std::uint64_t));
+    }
+    return bytes;
+}
+
+ExactResult solveExact(int capacity, const std::vector<Item>& items, long long nodeLimit, double timeLimitSeconds) {
+    if (dynamicProgrammingBytes(capacity, items.size(), true) <= kMaxDynamicProgrammingBytes) {
+        return solveByDynamicProgramming(capacity, items, true);
+    }
+    return solveByBranchAndBound(capacity, items, nodeLimit, timeLimitSeconds);
+}
+
+bool exactFastPathApplies(int capacity, std::size_t numItems, long long antEvaluations) {
+    long long cells = static_cast<long long>(numItems) * (static_cast<long long>(std::max(capacity, 0)) + 1);
+    long long antCost = antEvaluations * static_cast<long long>(numItems) * kCellsPerAntItem;
+    return dynamicProgrammingBytes(capacity, numItems, true) <= kMaxDynamicProgrammingBytes && cells <= antCost;
+}
@@ -0,0 +1,44 @@
+#include "fingerprint_set.h"
+#include <algorithm>
+
+const char* duplicateCacheModeName(DuplicateCacheMode mode) {
+    switch (mode) {
+        case DuplicateCacheMode::Off:            return "desligado";
+        case DuplicateCacheMode::PerIteration:   return "iteracao";
+        case DuplicateCacheMode::CrossIteration: return "global";
+    }
+    return "desconhecido";
+}
+
+bool parseDuplicateCacheMode(const std::string& name, DuplicateCacheMode& mode) {
+    for (DuplicateCacheMode candidate : {DuplicateCacheMode::Off, DuplicateCacheMode::PerIteration,
+                                         DuplicateCacheMode::CrossIteration}) {
+        if (name == duplicateCacheModeName(candidate)) {
+            mode = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+void FingerprintSet::reserve(std::size_t expectedEntries) {
+    std::size_t capacity = 16;
+    while (capacity < 2 * expectedEntries) {
+        capacity *= 2;
+    }
+    keys_.assign(capacity, 0);
+    tags_.assign(capacity, -1);
+    generations_.assign(capacity, 0);
+    mask_ = capacity - 1;
+    size_ = 0;
+    generation_ = 1;
+}
+
+void FingerprintSet::clear() {
+    size_ = 0;
+    if (++generation_ == 0) {
+        // Volta da contagem de gerações: zera de verdade para não ressuscitar entradas antigas
+        std::fill(generations_.begin(), generations_.end(), 0);
+        generation_ = 1;
+    }
+}
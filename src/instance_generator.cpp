@@ -0,0 +1,132 @@
+#include "instance_generator.h"
+#include <random>
+#include <algorithm>
+#include <climits>
+
+namespace {
+
+struct ClassName {
+    InstanceClass instanceClass;
+    const char* name;
+};
+
+const ClassName kClassNames[] = {
+    {InstanceClass::Uncorrelated, "uncorrelated"},
+    {InstanceClass::WeaklyCorrelated, "weakly_correlated"},
+    {InstanceClass::StronglyCorrelated, "strongly_correlated"},
+    {InstanceClass::InverseStronglyCorrelated, "inverse_strongly_correlated"},
+    {InstanceClass::SubsetSum, "subset_sum"},
+};
+
+} // namespace
+
+const char* instanceClassName(InstanceClass instanceClass) {
+    for (const ClassName& entry : kClassNames) {
+        if (entry.instanceClass == instanceClass) {
+            return entry.name;
+        }
+    }
+    return "unknown";
+}
+
+bool parseInstanceClass(const std::string& name, InstanceClass& instanceClass) {
+    for (const ClassName& entry : kClassNames) {
+        if (name == entry.name) {
+            instanceClass = entry.instanceClass;
+            return true;
+        }
+    }
+    return false;
+}
+
+const std::vector<InstanceClass>& allInstanceClasses() {
+    static const std::vector<InstanceClass> classes = {
+        InstanceClass::Uncorrelated, InstanceClass::WeaklyCorrelated, InstanceClass::StronglyCorrelated,
+        InstanceClass::InverseStronglyCorrelated, InstanceClass::SubsetSum};
+    return classes;
+}
+
+std::pair<int, std::vector<Item>> generateInstance(InstanceClass instanceClass, int numItems, unsigned int seed,
+                                                   int range, double capacityRatio) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> coefficient(1, range);
+    const int delta = std::max(1, range / 10);
+
+    std::vector<Item> items(numItems);
+    long long totalWeight = 0;
+    for (int i = 0; i < numItems; ++i) {
+        Item& item = items[i];
+        item.id = i;
+        switch (instanceClass) {
+            case InstanceClass::Uncorrelated:
+                item.weight = coefficient(rng);
+                item.value = coefficient(rng);
+                break;
+            case InstanceClass::WeaklyCorrelated: {
+                item.weight = coefficient(rng);
+                std::uniform_int_distribution<int> noise(-delta, delta);
+                item.value = std::max(1, item.weight + noise(rng));
+                break;
+            }
+            case InstanceClass::StronglyCorrelated:
+                item.weight = coefficient(rng);
+                item.value = item.weight + delta;
+                break;
+            case InstanceClass::InverseStronglyCorrelated:
+                item.value = coefficient(rng);
+                item.weight = item.value + delta;
+                break;
+            case InstanceClass::SubsetSum:
+                item.weight = coefficient(rng);
+                item.value = item.weight;
+                break;
+        }
+        totalWeight += item.weight;
+    }
+
+    long long capacity = static_cast<long long>(capacityRatio * static_cast<double>(totalWeight));
+    capacity = std::min<long long>(std::max<long long>(capacity, 1), INT_MAX);
+    return {static_cast<int>(capacity), items};
+}
+
+std::pair<int, std::vector<Item>> perturbInstance(int capacity, const std::vector<Item>& items, double fraction,
+                                                  unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> jitter(0.9, 1.1);
+    const std::size_t changes = static_cast<std::size_t>(fraction / 3.0 * static_cast<double>(items.size()));
+
+    // Remoção: embaralha as posições e descarta as primeiras
+    std::vector<Item> result(items);
+    std::shuffle(result.begin(), result.end(), rng);
+    result.erase(result.begin(), result.begin() + std::min(changes, result.size()));
+
+    // Alteração de valor nos primeiros que sobraram (a ordem já é aleatória)
+    for (std::size_t i = 0; i < std::min(changes, result.size()); ++i) {
+        result[i].value = std::max(1, static_cast<int>(result[i].value * jitter(rng)));
+    }
+
+    // Itens novos, parecidos com itens existentes
+    int nextId = 0;
+    for (const Item& item : items) {
+        nextId = std::max(nextId, item.id + 1);
+    }
+    if (!items.empty()) {
+        std::uniform_int_distribution<std::size_t> pick(0, items.size() - 1);
+        for (std::size_t i = 0; i < changes; ++i) {
+            const Item& model = items[pick(rng)];
+            Item item;
+            item.id = nextId++;
+            item.value = std::max(1, static_cast<int>(model.value * jitter(rng)));
+            item.weight = std::max(1, static_cast<int>(model.weight * jitter(rng)));
+            result.push_back(item);
+        }
+    }
+
+    // Ordem estável por id, como numa instância lida de arquivo
+    std::sort(result.begin(), result.end(), [](const Item& a, const Item& b) { return a.id < b.id; });
+
+    std::uniform_real_distribution<double> capacityJitter(0.99, 1.01);
+    long long newCapacity = static_cast<long long>(capacity * capacityJitter(rng));
+    newCapacity = std::min<long long>(std::max<long long>(newCapacity, 1), INT_MAX);
+    return {static_cast<int>(newCapacity), result};
+}
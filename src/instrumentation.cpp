@@ -0,0 +1,115 @@
+#include "instrumentation.h"
+#include <sstream>
+#include <iomanip>
+
+namespace {
+
+const char* const kPhaseNames[kAcoPhaseCount] = {
+    "construcao",
+    "passo_probabilistico",
+    "preenchimento_guloso",
+    "busca_local",
+    "avaliacao",
+    "atualizacao_feromonio",
+};
+
+struct CounterField {
+    const char* name;
+    std::uint64_t AcoInstrumentation::*field;
+};
+
+const CounterField kCounterFields[] = {
+    {"aceites_probabilisticos", &AcoInstrumentation::probabilisticAccepts},
+    {"rejeicoes_probabilisticas", &AcoInstrumentation::probabilisticRejects},
+    {"insercoes_gulosas", &AcoInstrumentation::greedyInsertions},
+    {"formigas_viaveis", &AcoInstrumentation::feasibleAnts},
+    {"formigas_inviaveis", &AcoInstrumentation::infeasibleAnts},
+    {"feromonio_no_piso", &AcoInstrumentation::pheromoneFloorHits},
+    {"movimentos_busca_local", &AcoInstrumentation::localSearchMoves},
+    {"formigas_melhoradas_busca_local", &AcoInstrumentation::localSearchImproved},
+    {"busca_local_evitada", &AcoInstrumentation::localSearchSkipped},
+    {"formigas_repetidas", &AcoInstrumentation::duplicateAnts},
+    {"repetidas_de_iteracoes_anteriores", &AcoInstrumentation::crossIterationDuplicates},
+};
+
+} // namespace
+
+const char* acoPhaseName(AcoPhase phase) {
+    int index = static_cast<int>(phase);
+    return (index >= 0 && index < kAcoPhaseCount) ? kPhaseNames[index] : "desconhecida";
+}
+
+void AcoInstrumentation::reset() {
+    for (std::uint64_t& cycles : phaseCycles) {
+        cycles = 0;
+    }
+    for (const CounterField& counter : kCounterFields) {
+        this->*counter.field = 0;
+    }
+    cyclesPerSecond = 0.0;
+}
+
+void AcoInstrumentation::merge(const AcoInstrumentation& other) {
+    for (int p = 0; p < kAcoPhaseCount; ++p) {
+        phaseCycles[p] += other.phaseCycles[p];
+    }
+    for (const CounterField& counter : kCounterFields) {
+        this->*counter.field += other.*counter.field;
+    }
+    if (cyclesPerSecond == 0.0) {
+        cyclesPerSecond = other.cyclesPerSecond;
+    }
+}
+
+double AcoInstrumentation::phaseSeconds(AcoPhase phase) const {
+    return (cyclesPerSecond > 0.0) ? phaseCycles[static_cast<int>(phase)] / cyclesPerSecond : 0.0;
+}
+
+double AcoInstrumentation::duplicateHitRate(std::uint64_t antsBuilt) const {
+    return (antsBuilt > 0) ? static_cast<double>(duplicateAnts + crossIterationDuplicates) / antsBuilt : 0.0;
+}
+
+std::string AcoInstrumentation::toJson() const {
+    std::ostringstream out;
+    out << std::setprecision(9) << "{\"ciclos_por_segundo\":" << cyclesPerSecond;
+    for (int p = 0; p < kAcoPhaseCount; ++p) {
+        out << ",\"ciclos_" << kPhaseNames[p] << "\":" << phaseCycles[p] << ",\"tempo_" << kPhaseNames[p] << "_s\":";
+        if (hasPhaseTimes()) {
+            out << phaseSeconds(static_cast<AcoPhase>(p));
+        } else {
+            out << "null";
+        }
+    }
+    for (const CounterField& counter : kCounterFields) {
+        out << ",\"" << counter.name << "\":" << this->*counter.field;
+    }
+    out << "}";
+    return out.str();
+}
+
+std::string AcoInstrumentation::csvHeader() {
+    std::ostringstream out;
+    out << "ciclos_por_segundo";
+    for (int p = 0; p < kAcoPhaseCount; ++p) {
+        out << ",ciclos_" << kPhaseNames[p] << ",tempo_" << kPhaseNames[p] << "_s";
+    }
+    for (const CounterField& counter : kCounterFields) {
+        out << "," << counter.name;
+    }
+    return out.str();
+}
+
+std::string AcoInstrumentation::toCsvRow() const {
+    std::ostringstream out;
+    out << std::setprecision(9) << cyclesPerSecond;
+    for (int p = 0; p < kAcoPhaseCount; ++p) {
+        out << "," << phaseCycles[p] << ",";
+        if (hasPhaseTimes()) {
+            out << phaseSeconds(static_cast<AcoPhase>(p));
+        }
+    }
+    for (const CounterField& counter : kCounterFields) {
+        out << "," << this->*counter.field;
+    }
+    return out.str();
+}
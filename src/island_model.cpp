@@ -0,0 +1,194 @@
+#include "island_model.h"
+#include "rng.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+
+const char* migrationTopologyName(MigrationTopology topology) {
+    return (topology == MigrationTopology::Ring) ? "anel" : "completa";
+}
+
+bool parseMigrationTopology(const std::string& name, MigrationTopology& topology) {
+    if (name == "anel") {
+        topology = MigrationTopology::Ring;
+        return true;
+    }
+    if (name == "completa") {
+        topology = MigrationTopology::FullyConnected;
+        return true;
+    }
+    return false;
+}
+
+IslandModel::Mailbox::Mailbox(std::size_t numItems, bool withPheromones)
+    : middle_(1), back_(0), front_(2) {
+    for (MigrationMessage& slot : slots_) {
+        slot.solution.reset(numItems);
+        if (withPheromones) {
+            slot.pheromoneTake.assign(numItems, 0.0);
+            slot.pheromoneNotTake.assign(numItems, 0.0);
+        }
+    }
+}
+
+IslandModel::MigrationMessage& IslandModel::Mailbox::writeSlot() {
+    return slots_[back_];
+}
+
+void IslandModel::Mailbox::publish() {
+    back_ = middle_.exchange(back_ | kFresh, std::memory_order_acq_rel) & ~kFresh;
+}
+
+const IslandModel::MigrationMessage* IslandModel::Mailbox::receive() {
+    if ((middle_.load(std::memory_order_relaxed) & kFresh) == 0) {
+        return nullptr;
+    }
+    front_ = middle_.exchange(front_, std::memory_order_acq_rel) & ~kFresh;
+    return &slots_[front_];
+}
+
+IslandModel::IslandModel(int numAntsPerIsland, double evaporationRate, double alpha, double beta,
+                         int capacity, const std::vector<Item>& items, int maxIterations, unsigned int seed,
+                         const IslandConfig& config)
+    : config_(config), numAntsPerIsland_(numAntsPerIsland), stopRequested_(false) {
+    config_.numIslands = std::max(config_.numIslands, 1);
+    config_.migrationInterval = std::max(config_.migrationInterval, 1);
+    const int numIslands = config_.numIslands;
+    const bool withPheromones = config_.pheromoneBlend > 0.0;
+
+    // A ilha 0 usa a própria seed (com uma ilha o resultado é o de um ACO comum);
+    // as demais recebem seeds derivadas
+    islands_.resize(numIslands);
+    std::uint64_t seedState = seed;
+    for (int i = 0; i < numIslands; ++i) {
+        unsigned int islandSeed = (i == 0) ? seed : static_cast<unsigned int>(splitMix64(seedState));
+        islands_[i].aco.reset(new ACO(numAntsPerIsland, evaporationRate, alpha, beta, capacity, items,
+                                      maxIterations, islandSeed));
+        islands_[i].migrationsSent = 0;
+        islands_[i].migrationsImproved = 0;
+        islands_[i].startOffsetSeconds = 0.0;
+    }
+
+    // Uma caixa de correio por aresta (remetente -> destinatário)
+    for (int from = 0; from < numIslands; ++from) {
+        for (int to = 0; to < numIslands; ++to) {
+            bool connected = (config_.topology == MigrationTopology::Ring)
+                ? (numIslands > 1 && to == (from + 1) % numIslands)
+                : (to != from);
+            if (!connected) {
+                continue;
+            }
+            mailboxes_.emplace_back(new Mailbox(items.size(), withPheromones));
+            islands_[from].outbox.push_back(mailboxes_.back().get());
+            islands_[to].inbox.push_back(mailboxes_.back().get());
+        }
+    }
+
+    for (int i = 0; i < numIslands; ++i) {
+        Island& island = islands_[i];
+        island.aco->setIterationHook([this, &island](int iteration) { return migrate(island, iteration); });
+    }
+
+    pool_.reset(new ThreadPool(numIslands));
+}
+
+IslandModel::~IslandModel() = default;
+
+int IslandModel::numIslands() const {
+    return config_.numIslands;
+}
+
+bool IslandModel::migrate(Island& island, int iteration) {
+    if (stopRequested_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    if (iteration % config_.migrationInterval != 0) {
+        return true;
+    }
+
+    ACO& aco = *island.aco;
+    const bool withPheromones = config_.pheromoneBlend > 0.0;
+
+    // Envia: copia para o buffer do escritor (mesmo tamanho, sem alocar) e publica
+    for (Mailbox* mailbox : island.outbox) {
+        MigrationMessage& message = mailbox->writeSlot();
+        message.solution = aco.getBestSolution();
+        if (withPheromones) {
+            std::copy(aco.getPheromoneTake().begin(), aco.getPheromoneTake().end(), message.pheromoneTake.begin());
+            std::copy(aco.getPheromoneNotTake().begin(), aco.getPheromoneNotTake().end(),
+                      message.pheromoneNotTake.begin());
+        }
+        mailbox->publish();
+        ++island.migrationsSent;
+    }
+
+    // Recebe o que houver de novo; caixas vazias são ignoradas, sem esperar
+    for (Mailbox* mailbox : island.inbox) {
+        const MigrationMessage* message = mailbox->receive();
+        if (message == nullptr) {
+            continue;
+        }
+        if (withPheromones) {
+            aco.blendPheromones(message->pheromoneTake, message->pheromoneNotTake, config_.pheromoneBlend);
+        }
+        if (aco.injectSolution(message->solution)) {
+            ++island.migrationsImproved;
+        }
+    }
+    return true;
+}
+
+IslandResult IslandModel::solve(const SolveLimits& limits) {
+    const int numIslands = config_.numIslands;
+    std::vector<SolveResult> results(numIslands);
+    stopRequested_.store(false);
+    for (Island& island : islands_) {
+        island.migrationsSent = 0;
+        island.migrationsImproved = 0;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    pool_->parallelFor(numIslands, [&](int i, int) {
+        Island& island = islands_[i];
+        island.startOffsetSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        results[i] = island.aco->solve(limits);
+        if (results[i].stopReason == StopReason::TargetReached) {
+            stopRequested_.store(true, std::memory_order_relaxed);
+        }
+    });
+    double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    IslandResult result;
+    result.bestValue = 0;
+    result.worstValue = INT_MAX;
+    result.bestIsland = 0;
+    result.bestTimeSeconds = 0.0;
+    result.antsBuilt = 0;
+    result.migrationsSent = 0;
+    result.migrationsImproved = 0;
+    for (int i = 0; i < numIslands; ++i) {
+        const SolveResult& islandResult = results[i];
+        double foundAt = islands_[i].startOffsetSeconds + islandResult.bestTimeSeconds;
+        if (islandResult.bestValue > result.bestValue ||
+            (islandResult.bestValue == result.bestValue && foundAt < result.bestTimeSeconds)) {
+            result.bestValue = islandResult.bestValue;
+            result.bestIsland = i;
+            result.bestTimeSeconds = foundAt;
+        }
+        if (islandResult.worstValue > 0) {
+            result.worstValue = std::min(result.worstValue, islandResult.worstValue);
+        }
+        result.antsBuilt += static_cast<long long>(islandResult.iterations) * numAntsPerIsland_;
+        result.migrationsSent += islands_[i].migrationsSent;
+        result.migrationsImproved += islands_[i].migrationsImproved;
+    }
+    if (result.worstValue == INT_MAX) {
+        result.worstValue = 0;
+    }
+
+    result.solution = results[result.bestIsland].solution;
+    result.stopReason = results[result.bestIsland].stopReason;
+    result.elapsedSeconds = elapsedSeconds;
+    result.islands = std::move(results);
+    return result;
+}
@@ -0,0 +1,275 @@
+#include "local_search.h"
+#include <algorithm>
+#include <numeric>
+#include <climits>
+
+SwapLocalSearch::SwapLocalSearch(int capacity, const std::vector<Item>& items, int candidateListSize, int maxMoves)
+    : capacity_(capacity), candidateListSize_(static_cast<std::size_t>(std::max(candidateListSize, 1))),
+      maxMoves_(maxMoves) {
+    const size_t n = items.size();
+    values_.resize(n);
+    weights_.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        values_[i] = items[i].value;
+        weights_[i] = items[i].weight;
+    }
+
+    ratioOrder_.resize(n);
+    std::iota(ratioOrder_.begin(), ratioOrder_.end(), 0);
+    std::sort(ratioOrder_.begin(), ratioOrder_.end(), [this](int a, int b) {
+        bool freeA = (weights_[a] == 0);  // Peso zero na frente, como em reduction.cpp
+        bool freeB = (weights_[b] == 0);
+        if (freeA != freeB) {
+            return freeA;
+        }
+        long long lhs = static_cast<long long>(values_[a]) * weights_[b];
+        long long rhs = static_cast<long long>(values_[b]) * weights_[a];
+        return (lhs != rhs) ? lhs > rhs : a < b;
+    });
+
+    rankOf_.resize(n);
+    for (size_t k = 0; k < n; ++k) {
+        rankOf_[ratioOrder_[k]] = static_cast<int>(k);
+    }
+
+    minWeightFromRank_.resize(n);
+    int minWeight = INT_MAX;
+    for (size_t k = n; k-- > 0;) {
+        minWeight = std::min(minWeight, weights_[ratioOrder_[k]]);
+        minWeightFromRank_[k] = minWeight;
+    }
+}
+
+void SwapLocalSearch::prepare(LocalSearchScratch& scratch) const {
+    // Durante um movimento as listas só crescem (o corte fica para refillCandidates()): o drop/add
+    // pode pôr até candidateListSize itens na lista de dentro, e o 2-1 dois na de fora
+    scratch.dropCandidates.reserve(2 * candidateListSize_ + 2);
+    scratch.addCandidates.reserve(2 * candidateListSize_ + 2);
+    scratch.heavyCandidates.reserve(ratioOrder_.size());
+}
+
+int SwapLocalSearch::improve(Solution& solution, LocalSearchScratch& scratch) const {
+    scratch.dropCandidates.clear();
+    scratch.addCandidates.clear();
+    scratch.heavyCandidates.clear();
+    scratch.dropCursor = ratioOrder_.size();
+    scratch.addCursor = 0;
+    refillCandidates(solution, scratch);
+
+    int moves = 0;
+    while (moves < maxMoves_) {
+        if (tryAdd(solution, scratch) || trySwapOneOne(solution, scratch) || trySwapTwoOne(solution, scratch) ||
+            tryDropAdd(solution, scratch)) {
+            ++moves;
+            refillCandidates(solution, scratch);
+            continue;
+        }
+        break;
+    }
+    return moves;
+}
+
+void SwapLocalSearch::refillCandidates(const Solution& solution, LocalSearchScratch& scratch) const {
+    // Corta o excesso deixado pelo último movimento (os de razão mais próxima do meio saem e a
+    // varredura recua até eles) e continua a varredura de onde parou
+    std::vector<int>& drops = scratch.dropCandidates;
+    while (drops.size() > candidateListSize_) {
+        scratch.dropCursor = static_cast<size_t>(rankOf_[drops.back()]) + 1;
+        drops.pop_back();
+    }
+    while (drops.size() < candidateListSize_ && scratch.dropCursor > 0) {
+        int idx = ratioOrder_[--scratch.dropCursor];
+        if (solution.test(idx)) {
+            drops.push_back(idx);
+        }
+    }
+
+    // O corte recua a varredura: os itens à parte de lá em diante serão vistos de novo
+    std::vector<int>& adds = scratch.addCandidates;
+    std::vector<int>& heavy = scratch.heavyCandidates;
+    while (adds.size() > candidateListSize_) {
+        scratch.addCursor = static_cast<size_t>(rankOf_[adds.back()]);
+        adds.pop_back();
+    }
+
+    // Um item de fora só entra em alguma troca se couber depois de tirar o maior candidato de dentro
+    // (duas vezes, no 2-1). Os mais pesados que isso ficam à parte em heavyCandidates e voltam
+    // para a lista, pela ordem de razão, assim que reachable crescer o bastante
+    int largestDrop = 0;
+    for (int idx : drops) {
+        largestDrop = std::max(largestDrop, weights_[idx]);
+    }
+    const long long reachable = capacity_ - solution.weight() + 2LL * largestDrop;
+    size_t kept = 0;
+    for (int idx : heavy) {
+        const size_t rank = static_cast<size_t>(rankOf_[idx]);
+        if (rank >= scratch.addCursor) {
+            break;  // A varredura recuou até aqui; daqui em diante ela mesma revê os itens
+        }
+        if (weights_[idx] > reachable) {
+            heavy[kept++] = idx;
+            continue;
+        }
+        if (adds.size() == candidateListSize_) {
+            if (rank > static_cast<size_t>(rankOf_[adds.back()])) {
+                scratch.addCursor = rank;  // Lista cheia com itens melhores: a varredura recua até ele
+                break;
+            }
+            scratch.addCursor = static_cast<size_t>(rankOf_[adds.back()]);
+            adds.pop_back();
+        }
+        insertByRank(adds, idx);
+    }
+    heavy.resize(kept);
+
+    const size_t n = ratioOrder_.size();
+    while (adds.size() < candidateListSize_ && scratch.addCursor < n) {
+        if (minWeightFromRank_[scratch.addCursor] > reachable) {
+            break;  // Nada daqui em diante cabe; a varredura volta daqui se reachable crescer
+        }
+        int idx = ratioOrder_[scratch.addCursor++];
+        if (!solution.test(idx)) {
+            (weights_[idx] <= reachable ? adds : heavy).push_back(idx);
+        }
+    }
+}
+
+void SwapLocalSearch::insertByRank(std::vector<int>& adds, int idx) const {
+    const int rank = rankOf_[idx];
+    auto at = std::find_if(adds.begin(), adds.end(), [&](int other) { return rankOf_[other] > rank; });
+    adds.insert(at, idx);
+}
+
+void SwapLocalSearch::takeItem(Solution& solution, LocalSearchScratch& scratch, int idx) const {
+    solution.add(idx, values_[idx], weights_[idx]);
+
+    std::vector<int>& adds = scratch.addCandidates;
+    adds.erase(std::remove(adds.begin(), adds.end(), idx), adds.end());
+
+    // Dentro da faixa já varrida pela lista de dentro: entra na posição da sua razão (pior primeiro)
+    const size_t rank = static_cast<size_t>(rankOf_[idx]);
+    if (rank >= scratch.dropCursor) {
+        std::vector<int>& drops = scratch.dropCandidates;
+        auto at = std::find_if(drops.begin(), drops.end(), [&](int other) {
+            return static_cast<size_t>(rankOf_[other]) < rank;
+        });
+        drops.insert(at, idx);
+    }
+}
+
+void SwapLocalSearch::dropItem(Solution& solution, LocalSearchScratch& scratch, int idx) const {
+    solution.remove(idx, values_[idx], weights_[idx]);
+
+    std::vector<int>& drops = scratch.dropCandidates;
+    drops.erase(std::remove(drops.begin(), drops.end(), idx), drops.end());
+
+    // Dentro da faixa já varrida pela lista de fora: entra na posição da sua razão (melhor primeiro)
+    if (static_cast<size_t>(rankOf_[idx]) < scratch.addCursor) {
+        insertByRank(scratch.addCandidates, idx);
+    }
+}
+
+bool SwapLocalSearch::tryAdd(Solution& solution, LocalSearchScratch& scratch) const {
+    // Mesma escolha do preenchimento guloso, restrita à lista: o primeiro de fora que cabe
+    const long long residual = capacity_ - solution.weight();
+    for (int idx : scratch.addCandidates) {
+        if (weights_[idx] <= residual) {
+            takeItem(solution, scratch, idx);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SwapLocalSearch::trySwapOneOne(Solution& solution, LocalSearchScratch& scratch) const {
+    const long long residual = capacity_ - solution.weight();
+    long long bestDelta = 0;
+    int bestDrop = -1;
+    int bestAdd = -1;
+    for (int out : scratch.dropCandidates) {
+        for (int in : scratch.addCandidates) {
+            long long delta = static_cast<long long>(values_[in]) - values_[out];
+            if (delta > bestDelta && weights_[in] <= residual + weights_[out]) {
+                bestDelta = delta;
+                bestDrop = out;
+                bestAdd = in;
+            }
+        }
+    }
+    if (bestDrop < 0) {
+        return false;
+    }
+    dropItem(solution, scratch, bestDrop);
+    takeItem(solution, scratch, bestAdd);
+    return true;
+}
+
+bool SwapLocalSearch::trySwapTwoOne(Solution& solution, LocalSearchScratch& scratch) const {
+    const long long residual = capacity_ - solution.weight();
+    const std::vector<int>& drops = scratch.dropCandidates;
+    long long bestDelta = 0;
+    int bestFirst = -1;
+    int bestSecond = -1;
+    int bestAdd = -1;
+    for (size_t a = 0; a < drops.size(); ++a) {
+        for (size_t b = a + 1; b < drops.size(); ++b) {
+            long long freedValue = static_cast<long long>(values_[drops[a]]) + values_[drops[b]];
+            long long freedWeight = residual + weights_[drops[a]] + weights_[drops[b]];
+            for (int in : scratch.addCandidates) {
+                long long delta = values_[in] - freedValue;
+                if (delta > bestDelta && weights_[in] <= freedWeight) {
+                    bestDelta = delta;
+                    bestFirst = drops[a];
+                    bestSecond = drops[b];
+                    bestAdd = in;
+                }
+            }
+        }
+    }
+    if (bestAdd < 0) {
+        return false;
+    }
+    dropItem(solution, scratch, bestFirst);
+    dropItem(solution, scratch, bestSecond);
+    takeItem(solution, scratch, bestAdd);
+    return true;
+}
+
+bool SwapLocalSearch::tryDropAdd(Solution& solution, LocalSearchScratch& scratch) const {
+    const long long residual = capacity_ - solution.weight();
+    long long bestDelta = 0;
+    int bestDrop = -1;
+    for (int out : scratch.dropCandidates) {
+        // Reenchimento guloso simulado: só soma pesos e valores, sem tocar na solução
+        long long room = residual + weights_[out];
+        long long gained = 0;
+        for (int in : scratch.addCandidates) {
+            if (weights_[in] <= room) {
+                room -= weights_[in];
+                gained += values_[in];
+            }
+        }
+        long long delta = gained - values_[out];
+        if (delta > bestDelta) {
+            bestDelta = delta;
+            bestDrop = out;
+        }
+    }
+    if (bestDrop < 0) {
+        return false;
+    }
+
+    // Mesmo reenchimento da simulação: bestDrop pode ter voltado para a lista de fora e fica de
+    // lado; takeItem() tira da lista o item que entra, então o índice só avança quando ele não cabe
+    dropItem(solution, scratch, bestDrop);
+    std::vector<int>& adds = scratch.addCandidates;
+    for (size_t k = 0; k < adds.size();) {
+        int in = adds[k];
+        if (in != bestDrop && weights_[in] <= capacity_ - solution.weight()) {
+            takeItem(solution, scratch, in);
+        } else {
+            ++k;
+        }
+    }
+    return true;
+}
@@ -1,5 +1,11 @@
 #include "aco.h"
 #include "utils.h"
+#include "run_scheduler.h"
+#include "reduction.h"
+#include "exact_solver.h"
+#include "batch_solver.h"
+#include "tuner.h"
+#include "trace_writer.h"
 #include <iostream>
 #include <vector>
 #include <numeric>
@@ -9,12 +15,16 @@
 #include <chrono>
 #include <random>
 #include <fstream>
+#include <tuple>
+#include <cstdlib>
 
 // Função para salvar o resultado de uma execução no CSV
-void saveExecutionResultToCSV(std::ofstream& csvFile, int execNumber, int bestValue, int worstValue, double execTime, unsigned int seed, 
+void saveExecutionResultToCSV(std::ofstream& csvFile, int execNumber, int bestValue, int worstValue, double execTime,
+                              double cpuTime, unsigned int seed,
                               const std::vector<int>& solution, const std::vector<Item>& items) {
     csvFile << execNumber << "," << bestValue << "," << worstValue << ","
             << std::fixed << std::setprecision(4) << execTime << ","
+            << std::fixed << std::setprecision(4) << cpuTime << ","
             << seed << ",";
 
     bool hasItem = false;
@@ -41,7 +51,149 @@ void saveExecutionResultToCSV(std::ofstream& csvFile, int execNumber, int bestVa
     csvFile << "\n";
 }
 
-int main() {
+// Distribuição de qualidade e tempo até o alvo de uma configuração na validação do ajuste
+void printValidationStats(const std::string& label, const ParameterConfig& parameters, const ValidationStats& stats) {
+    std::cout << std::defaultfloat << std::setprecision(6) << label << ": formigas=" << parameters.numAnts << ", evaporacao=" << parameters.evaporationRate
+              << ", alfa=" << parameters.alpha << ", beta=" << parameters.beta << std::endl;
+    std::cout << std::fixed << std::setprecision(4)
+              << "  Qualidade (valor/referencia) min/p10/mediana/media/max: " << stats.qualityMin << " / "
+              << stats.qualityP10 << " / " << stats.qualityMedian << " / " << stats.qualityMean << " / "
+              << stats.qualityMax << std::endl;
+    std::cout << "  Atingiu a referencia: " << std::setprecision(1) << 100.0 * stats.targetHitRate << "% de "
+              << stats.runs << " execucoes; tempo ate o alvo mediana/p90: " << std::setprecision(4)
+              << stats.timeToTargetMedian << " / " << stats.timeToTargetP90 << " s (mediana de "
+              << std::setprecision(0) << stats.iterationsToTargetMedian << " iteracoes)" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    // Modo conversor entre os formatos texto e binário: programa --converter entrada saida
+    if (argc >= 2 && std::string(argv[1]) == "--converter") {
+        if (argc != 4) {
+            std::cerr << "Uso: " << argv[0] << " --converter <entrada> <saida>" << std::endl;
+            return 1;
+        }
+        std::string error;
+        if (!convertInstance(argv[2], argv[3], error)) {
+            std::cerr << error << std::endl;
+            return 1;
+        }
+        std::cout << "Instancia convertida: " << argv[2] << " -> " << argv[3] << std::endl;
+        return 0;
+    }
+
+    // Modo lote: uma tarefa por linha na entrada padrão, um resultado JSON por linha na saída padrão
+    // (formato das linhas em batch_solver.h): programa --lote [--threads N] [--fila N] [--atalho-exato]
+    if (argc >= 2 && std::string(argv[1]) == "--lote") {
+        BatchConfig config;
+        for (int a = 2; a < argc; ++a) {
+            std::string flag = argv[a];
+            if ((flag == "--threads" || flag == "--fila") && a + 1 < argc) {
+                int value = std::atoi(argv[++a]);
+                if (flag == "--threads") {
+                    config.numWorkers = value;
+                } else {
+                    config.queueCapacity = static_cast<std::size_t>(std::max(value, 1));
+                }
+            } else if (flag == "--atalho-exato") {
+                config.useExactFastPath = true;
+            } else {
+                std::cerr << "Uso: " << argv[0] << " --lote [--threads N] [--fila N] [--atalho-exato]" << std::endl;
+                return 1;
+            }
+        }
+        BatchSummary summary = runBatch(std::cin, std::cout, config);
+        std::cerr << std::fixed << std::setprecision(4)
+                  << "--- Resumo do modo lote ---\n"
+                  << "Tarefas: " << summary.jobs << " (resolvidas " << summary.solved << ", expiradas "
+                  << summary.expired << ", com erro " << summary.failed << ")\n"
+                  << "Tempo total: " << summary.wallSeconds << " s (" << summary.jobsPerSecond << " tarefas/s)\n"
+                  << "Latencia p50/p90/p99/max: " << summary.latencyP50 << " / " << summary.latencyP90 << " / "
+                  << summary.latencyP99 << " / " << summary.latencyMax << " s" << std::endl;
+        return (summary.failed == 0) ? 0 : 1;
+    }
+
+    // Modo de ajuste dos parâmetros por corrida (F-race, ver tuner.h):
+    // programa --ajustar [--instancias L] [--configuracoes N] [--orcamento N] [--avaliacoes N]
+    //                    [--validacao N] [--threads N] [--seed N]
+    if (argc >= 2 && std::string(argv[1]) == "--ajustar") {
+        TunerConfig config;
+        std::string instanceList = "data/knapsack-instance.txt";
+        for (int a = 2; a < argc; ++a) {
+            std::string flag = argv[a];
+            if (a + 1 >= argc) {
+                flag.clear();
+            }
+            if (flag == "--instancias") {
+                instanceList = argv[++a];
+            } else if (flag == "--configuracoes") {
+                config.numConfigurations = std::atoi(argv[++a]);
+            } else if (flag == "--orcamento") {
+                config.evaluationBudget = std::atoll(argv[++a]);
+            } else if (flag == "--avaliacoes") {
+                config.antEvaluations = std::max(1, std::atoi(argv[++a]));
+            } else if (flag == "--validacao") {
+                config.validationRuns = std::atoi(argv[++a]);
+            } else if (flag == "--threads") {
+                config.numThreads = std::atoi(argv[++a]);
+            } else if (flag == "--seed") {
+                config.seed = static_cast<unsigned int>(std::strtoul(argv[++a], nullptr, 10));
+            } else {
+                std::cerr << "Uso: " << argv[0] << " --ajustar [--instancias arquivo,classe:n[:k],...]"
+                          << " [--configuracoes N] [--orcamento N] [--avaliacoes N] [--validacao N]"
+                          << " [--threads N] [--seed N]" << std::endl;
+                return 1;
+            }
+        }
+        std::vector<TuningInstance> trainingInstances;
+        std::string error;
+        if (!loadTuningInstances(instanceList, config.seed, trainingInstances, error)) {
+            std::cerr << error << std::endl;
+            return 1;
+        }
+        std::cout << "--- Ajuste de Parametros (F-race) ---" << std::endl;
+        std::cout << "Instancias de treino: " << trainingInstances.size() << " (" << instanceList << ")" << std::endl;
+        std::cout << "Orcamento: " << config.evaluationBudget << " execucoes de " << config.antEvaluations
+                  << " solucoes construidas cada" << std::endl;
+
+        TuningResult tuning = raceParameters(trainingInstances, config, std::cout);
+        std::cout << "---------------------------------" << std::endl;
+        std::cout << "Candidatas: " << tuning.candidates << ", sobreviventes: " << tuning.survivors.size()
+                  << ", blocos: " << tuning.blocks << ", execucoes: " << tuning.evaluations << ", tempo da corrida: "
+                  << std::fixed << std::setprecision(2) << tuning.raceSeconds << " s" << std::endl;
+        if (config.validationRuns > 0) {
+            std::cout << "Validacao: " << config.validationRuns << " seeds novas por instancia" << std::endl;
+            printValidationStats("Melhor configuracao", tuning.best, tuning.bestStats);
+            printValidationStats("Configuracao atual", config.baseline, tuning.baselineStats);
+        } else {
+            std::cout << std::defaultfloat << "Melhor configuracao: formigas=" << tuning.best.numAnts << ", evaporacao="
+                      << tuning.best.evaporationRate << ", alfa=" << tuning.best.alpha << ", beta="
+                      << tuning.best.beta << std::endl;
+        }
+        return 0;
+    }
+
+    // Modo padrão: programa [--atalho-exato] [--reducao] [--traco arquivo] [--instrumentacao arquivo]
+    bool useExactFastPath = false;
+    bool useCoreReduction = false;
+    std::string traceFilePath;
+    std::string instrumentationFilePath;  // CSV com ciclos por fase e contadores de cada execução
+    for (int a = 1; a < argc; ++a) {
+        std::string flag = argv[a];
+        if (flag == "--atalho-exato") {
+            useExactFastPath = true;
+        } else if (flag == "--reducao") {
+            useCoreReduction = true;
+        } else if (flag == "--traco" && a + 1 < argc) {
+            traceFilePath = argv[++a];
+        } else if (flag == "--instrumentacao" && a + 1 < argc) {
+            instrumentationFilePath = argv[++a];
+        } else {
+            std::cerr << "Uso: " << argv[0] << " [--atalho-exato] [--reducao] [--traco arquivo]"
+                      << " [--instrumentacao arquivo]" << std::endl;
+            return 1;
+        }
+    }
+
     std::string instanceFilePath = "data/knapsack-instance.txt";
     std::pair<int, std::vector<Item>> knapsackData = readKnapsackInstance(instanceFilePath);
     int capacity = knapsackData.first;
@@ -65,6 +217,15 @@ int main() {
     double beta = 2.5;
     int maxIterations = 20000 / numAnts;
     int numExecutions = 15;
+    // Redução ao núcleo (--reducao): fixa os itens decididos pelos limites de Dantzig e roda o ACO só
+    // no núcleo. Desligada por padrão porque muda o espaço de busca e os resultados do ACO.
+    // Traço de convergência (--traco arquivo): cada iteração de todas as execuções, gravada por uma
+    // thread de fundo e lida por traco_aco.py. Sem a opção não há arquivo nem thread.
+    // Atalho exato (--atalho-exato): se a DP custa menos que as avaliações do ACO, responde direto com
+    // o ótimo. Desligado por padrão porque este programa existe para medir o ACO (a instância padrão
+    // se qualifica).
+    double exactTimeLimitSeconds = 10.0;  // Limite do branch-and-bound de referência (instâncias grandes)
+    RunScheduler scheduler;  // Execuções independentes distribuídas entre todos os núcleos
 
     std::vector<int> bestValues;
     std::vector<int> worstValues;               // Para armazenar os piores valores
@@ -86,8 +247,55 @@ int main() {
     std::cout << "Maximo de Iteracoes por Execucao: " << maxIterations << std::endl;
     std::cout << "Numero Total de Avaliacoes da Função Objetivo por Execucao: " << numAnts * maxIterations << std::endl;
     std::cout << "Numero Total de Execucoes: " << numExecutions << std::endl;
+    std::cout << "Threads para as Execucoes: " << scheduler.numThreads() << std::endl;
+    std::cout << "---------------------------------" << std::endl;
+
+    // Redução ao núcleo: o ACO só decide os itens que os limites não conseguem fixar
+    ReducedInstance reduced = reduceInstance(capacity, items);
+    if (!useCoreReduction) {
+        reduced.coreItems = items;
+        reduced.coreToOriginal.resize(items.size());
+        std::iota(reduced.coreToOriginal.begin(), reduced.coreToOriginal.end(), 0);
+        reduced.fixedIn.clear();
+        reduced.numFixedOut = 0;
+        reduced.fixedValue = 0;
+        reduced.fixedWeight = 0;
+        reduced.capacity = capacity;
+    }
+    std::cout << "Limite Superior (Dantzig): " << std::fixed << std::setprecision(2) << reduced.upperBound << std::endl;
+    std::cout << "Limite Inferior (Guloso): " << reduced.lowerBound << std::endl;
+    std::cout << "Reducao ao Nucleo: " << (useCoreReduction ? "ativada" : "desativada")
+              << " (" << reduced.fixedIn.size() << " itens fixados dentro, " << reduced.numFixedOut
+              << " fora, nucleo com " << reduced.coreItems.size() << " itens e capacidade " << reduced.capacity
+              << ")" << std::endl;
+
+    // Ótimo de referência para o gap real, resolvido sobre o núcleo (a redução preserva os ótimos)
+    ExactResult exact = solveExact(reduced.capacity, reduced.coreItems, 0, exactTimeLimitSeconds);
+    long long optimumValue = exact.value + reduced.fixedValue;
+    auto gapToOptimum = [optimumValue](double value) {
+        return (optimumValue - value) / std::max(1LL, optimumValue);
+    };
+    std::cout << "Otimo (" << exactMethodName(exact.method) << "): " << optimumValue
+              << (exact.optimal ? "" : " (limite de tempo atingido; melhor valor conhecido)")
+              << ", Tempo = " << std::fixed << std::setprecision(4) << exact.seconds << "s" << std::endl;
     std::cout << "---------------------------------" << std::endl;
 
+    if (useExactFastPath && exact.optimal &&
+        exactFastPathApplies(reduced.capacity, reduced.coreItems.size(), static_cast<long long>(numAnts) * maxIterations)) {
+        std::vector<int> solution = expandSolution(reduced, exact.solution, items.size());
+        std::cout << "Atalho exato: a programacao dinamica e mais barata que " << numAnts * maxIterations
+                  << " avaliacoes do ACO." << std::endl;
+        std::cout << "Valor otimo: " << optimumValue << std::endl;
+        std::cout << "Itens incluídos: ";
+        for (size_t i = 0; i < solution.size(); ++i) {
+            if (solution[i] == 1) {
+                std::cout << items[i].id << " ";
+            }
+        }
+        std::cout << std::endl;
+        return 0;
+    }
+
     // Abre arquivo CSV para escrita
     std::ofstream csvFile("resultados_aco.csv");
     if (!csvFile.is_open()) {
@@ -95,24 +303,57 @@ int main() {
         return 1;
     }
     // Cabeçalho do CSV com coluna para pior valor
-    csvFile << "Execucao,MelhorValor,PiorValor,Tempo,Seed,ItensIncluidos\n";
+    csvFile << "Execucao,MelhorValor,PiorValor,Tempo,TempoCPU,Seed,ItensIncluidos\n";
 
     for (int exec = 0; exec < numExecutions; ++exec) {
-        unsigned int currentSeed = initial_seed_rng();
-        seedsUsed.push_back(currentSeed);
-
-        auto start_time = std::chrono::high_resolution_clock::now();
+        seedsUsed.push_back(initial_seed_rng());
+    }
 
-        ACO aco(numAnts, evaporationRate, alpha, beta, capacity, items, maxIterations, currentSeed);
+    // O traço é escrito por uma thread de fundo enquanto as execuções rodam
+    TraceWriter trace;
+    bool tracing = false;
+    if (!traceFilePath.empty()) {
+        std::string error;
+        tracing = trace.open(traceFilePath, error);
+        if (!tracing) {
+            std::cerr << error << " (seguindo sem traço)" << std::endl;
+        }
+    }
 
-        std::tuple<std::vector<int>, int, int> solveResult = aco.solve();
-        std::vector<int> solution = std::get<0>(solveResult);
-        int bestValue = std::get<1>(solveResult);
-        int worstValue = std::get<2>(solveResult);
+    // Cada execução grava somente na sua própria posição; não há lock na coleta dos resultados
+    std::vector<std::tuple<std::vector<int>, int, int>> solveResults(numExecutions);
+    std::vector<AcoInstrumentation> instrumentations(numExecutions);
+    std::vector<RunTiming> timings = scheduler.run(numExecutions, [&](int exec) {
+        ACO aco(numAnts, evaporationRate, alpha, beta, reduced.capacity, reduced.coreItems, maxIterations,
+                seedsUsed[exec]);
+        if (tracing) {
+            aco.setTrace(&trace, static_cast<std::uint32_t>(exec + 1), static_cast<int>(reduced.fixedValue));
+        }
+        std::tuple<std::vector<int>, int, int> coreResult = aco.solve();
+
+        // De volta à instância original: itens fixados dentro entram em todas as soluções
+        solveResults[exec] = std::make_tuple(expandSolution(reduced, std::get<0>(coreResult), items.size()),
+                                             std::get<1>(coreResult) + static_cast<int>(reduced.fixedValue),
+                                             std::get<2>(coreResult) + static_cast<int>(reduced.fixedValue));
+        instrumentations[exec] = aco.getInstrumentation();
+    });
+    if (tracing) {
+        trace.close();
+        std::cout << "Traco de convergencia: " << trace.written() << " iteracoes gravadas em " << traceFilePath;
+        if (trace.dropped() > 0) {
+            std::cout << " (" << trace.dropped() << " descartadas com o anel cheio)";
+        }
+        std::cout << std::endl;
+    }
 
-        auto end_time = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<double> elapsed = end_time - start_time;
-        double currentExecutionTime = elapsed.count();
+    // Relatório na ordem das execuções, independente de qual terminou primeiro
+    for (int exec = 0; exec < numExecutions; ++exec) {
+        unsigned int currentSeed = seedsUsed[exec];
+        const std::vector<int>& solution = std::get<0>(solveResults[exec]);
+        int bestValue = std::get<1>(solveResults[exec]);
+        int worstValue = std::get<2>(solveResults[exec]);
+        double currentExecutionTime = timings[exec].wallSeconds;
+        double currentCpuTime = timings[exec].cpuSeconds;
 
         bestValues.push_back(bestValue);
         worstValues.push_back(worstValue);
@@ -123,6 +364,9 @@ int main() {
                   << ": Melhor valor = " << std::setw(6) << bestValue
                   << ", Pior valor = " << std::setw(6) << worstValue
                   << ", Tempo = " << std::fixed << std::setprecision(4) << currentExecutionTime << "s"
+                  << ", Tempo CPU = " << std::fixed << std::setprecision(4) << currentCpuTime << "s"
+                  << ", Gap para o otimo = " << std::fixed << std::setprecision(4)
+                  << 100.0 * gapToOptimum(bestValue) << "%"
                   << ", Seed = " << currentSeed << std::endl;
 
         std::cout << "Itens incluídos: ";
@@ -139,11 +383,26 @@ int main() {
         std::cout << std::endl;
 
         // Salva resultado no CSV
-        saveExecutionResultToCSV(csvFile, exec + 1, bestValue, worstValue, currentExecutionTime, currentSeed, solution, items);
+        saveExecutionResultToCSV(csvFile, exec + 1, bestValue, worstValue, currentExecutionTime, currentCpuTime,
+                                 currentSeed, solution, items);
     }
 
     csvFile.close();
 
+    // Instrumentação por execução (ciclos por fase e contadores do ACO), só com --instrumentacao
+    if (!instrumentationFilePath.empty()) {
+        std::ofstream instrumentationFile(instrumentationFilePath);
+        if (!instrumentationFile.is_open()) {
+            std::cerr << "Erro ao abrir arquivo CSV de instrumentacao para escrita." << std::endl;
+            return 1;
+        }
+        instrumentationFile << "Execucao,Seed," << AcoInstrumentation::csvHeader() << "\n";
+        for (int exec = 0; exec < numExecutions; ++exec) {
+            instrumentationFile << exec + 1 << "," << seedsUsed[exec] << "," << instrumentations[exec].toCsvRow() << "\n";
+        }
+        instrumentationFile.close();
+    }
+
     // --- Cálculo das métricas finais ---
 
     // MÉTRICAS DOS MELHORES VALORES
@@ -195,6 +454,13 @@ int main() {
     std::cout << "Mediana do melhor valor: " << medianBestValue << std::endl;
     std::cout << "Desvio padrao do valor: " << std::fixed << std::setprecision(2) << std_dev_best << std::endl;
     std::cout << "\n>>> MELHOR VALOR GLOBAL: " << bestOfAll << " (ocorreu em " << freqBest << " execucoes)" << std::endl;
+    std::cout << "Limite superior: " << std::fixed << std::setprecision(2) << reduced.upperBound
+              << ", gap para o limite de Dantzig: " << std::setprecision(4)
+              << 100.0 * optimalityGap(bestOfAll, reduced.upperBound) << "%" << std::endl;
+    std::cout << "Otimo " << (exact.optimal ? "exato" : "conhecido") << ": " << optimumValue
+              << ", gap para o otimo: " << std::setprecision(4) << 100.0 * gapToOptimum(bestOfAll) << "%"
+              << " (media do melhor valor: " << std::setprecision(4) << 100.0 * gapToOptimum(meanBestValue) << "%)"
+              << std::endl;
     std::cout << "---------------------------------------" << std::endl;
 
     std::cout << "Media do pior valor: " << std::fixed << std::setprecision(2) << meanWorstValue << std::endl;
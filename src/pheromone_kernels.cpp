@@ -0,0 +1,232 @@
+#include "pheromone_kernels.h"
+#include <algorithm>  // std::max
+#include <cmath>      // std::log2
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ACO_X86_KERNELS 1
+#endif
+
+namespace {
+
+// --- Versão escalar (referência) ---
+
+std::size_t evaporateScalar(double* values, std::size_t n, double factor, double floor) {
+    std::size_t floorHits = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        double evaporated = values[i] * factor;
+        floorHits += (evaporated < floor);
+        values[i] = std::max(evaporated, floor);
+    }
+    return floorHits;
+}
+
+// Depósito de uma palavra de 64 itens: percorre os bits ligados e desligados com ctz
+void depositWord(double* take, double* notTake, std::uint64_t word, std::uint64_t valid, double amount) {
+    std::uint64_t taken = word & valid;
+    std::uint64_t notTaken = ~word & valid;
+    while (taken != 0) {
+        take[__builtin_ctzll(taken)] += amount;
+        taken &= taken - 1;
+    }
+    while (notTaken != 0) {
+        notTake[__builtin_ctzll(notTaken)] += amount;
+        notTaken &= notTaken - 1;
+    }
+}
+
+// Trata a última palavra, possivelmente incompleta, a partir do item "done"
+void depositTail(double* take, double* notTake, const std::uint64_t* bits, std::size_t n,
+                 std::size_t done, double amount) {
+    if (done < n) {
+        std::uint64_t valid = (n - done >= 64) ? ~0ULL : ((1ULL << (n - done)) - 1);
+        depositWord(take + done, notTake + done, bits[done / 64], valid, amount);
+    }
+}
+
+void depositScalar(double* take, double* notTake, const std::uint64_t* bits, std::size_t n, double amount) {
+    std::size_t done = 0;
+    for (; done + 64 <= n; done += 64) {
+        depositWord(take + done, notTake + done, bits[done / 64], ~0ULL, amount);
+    }
+    depositTail(take, notTake, bits, n, done, amount);
+}
+
+#ifdef ACO_X86_KERNELS
+
+// Observação: _mm*_max_pd(a, b) devolve b quando a < b, como std::max(a, b)
+// quando nenhum operando é NaN; somar 0.0 a um feromônio positivo não o altera.
+// Por isso as versões vetoriais reproduzem exatamente a escalar. O depósito vetorial
+// processa palavras completas de 64 itens e deixa a última palavra para depositTail.
+
+// --- SSE2 (2 doubles por instrução) ---
+
+__attribute__((target("sse2")))
+std::size_t evaporateSSE2(double* values, std::size_t n, double factor, double floor) {
+    const __m128d f = _mm_set1_pd(factor);
+    const __m128d lo = _mm_set1_pd(floor);
+    std::size_t floorHits = 0;
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128d v = _mm_mul_pd(_mm_loadu_pd(values + i), f);
+        floorHits += __builtin_popcount(_mm_movemask_pd(_mm_cmplt_pd(v, lo)));
+        _mm_storeu_pd(values + i, _mm_max_pd(v, lo));
+    }
+    return floorHits + evaporateScalar(values + i, n - i, factor, floor);
+}
+
+__attribute__((target("sse2")))
+void depositSSE2(double* take, double* notTake, const std::uint64_t* bits, std::size_t n, double amount) {
+    const __m128d amt = _mm_set1_pd(amount);
+    std::size_t done = 0;
+    for (; done + 64 <= n; done += 64) {
+        const std::uint64_t word = bits[done / 64];
+        for (std::size_t g = 0; g < 64; g += 2) {
+            std::uint64_t pair = word >> g;
+            __m128d isTake = _mm_castsi128_pd(_mm_set_epi64x(-static_cast<long long>((pair >> 1) & 1),
+                                                             -static_cast<long long>(pair & 1)));
+            std::size_t i = done + g;
+            _mm_storeu_pd(take + i, _mm_add_pd(_mm_loadu_pd(take + i), _mm_and_pd(isTake, amt)));
+            _mm_storeu_pd(notTake + i, _mm_add_pd(_mm_loadu_pd(notTake + i), _mm_andnot_pd(isTake, amt)));
+        }
+    }
+    depositTail(take, notTake, bits, n, done, amount);
+}
+
+// --- AVX2 (4 doubles por instrução) ---
+
+__attribute__((target("avx2")))
+std::size_t evaporateAVX2(double* values, std::size_t n, double factor, double floor) {
+    const __m256d f = _mm256_set1_pd(factor);
+    const __m256d lo = _mm256_set1_pd(floor);
+    std::size_t floorHits = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d v = _mm256_mul_pd(_mm256_loadu_pd(values + i), f);
+        floorHits += __builtin_popcount(_mm256_movemask_pd(_mm256_cmp_pd(v, lo, _CMP_LT_OQ)));
+        _mm256_storeu_pd(values + i, _mm256_max_pd(v, lo));
+    }
+    return floorHits + evaporateScalar(values + i, n - i, factor, floor);
+}
+
+__attribute__((target("avx2")))
+void depositAVX2(double* take, double* notTake, const std::uint64_t* bits, std::size_t n, double amount) {
+    const __m256d amt = _mm256_set1_pd(amount);
+    const __m256i lanes = _mm256_set_epi64x(8, 4, 2, 1);
+    std::size_t done = 0;
+    for (; done + 64 <= n; done += 64) {
+        const std::uint64_t word = bits[done / 64];
+        for (std::size_t g = 0; g < 64; g += 4) {
+            __m256i nibble = _mm256_set1_epi64x(static_cast<long long>((word >> g) & 0xF));
+            __m256d isTake = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(nibble, lanes), lanes));
+            std::size_t i = done + g;
+            _mm256_storeu_pd(take + i, _mm256_add_pd(_mm256_loadu_pd(take + i), _mm256_and_pd(isTake, amt)));
+            _mm256_storeu_pd(notTake + i, _mm256_add_pd(_mm256_loadu_pd(notTake + i), _mm256_andnot_pd(isTake, amt)));
+        }
+    }
+    depositTail(take, notTake, bits, n, done, amount);
+}
+
+// --- AVX-512 (8 doubles por instrução, com máscaras) ---
+
+// Os cabeçalhos do GCC 12 usam _mm512_undefined_pd() internamente, o que gera falsos
+// avisos de "may be used uninitialized" ao expandir estes intrínsecos.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+std::size_t evaporateAVX512(double* values, std::size_t n, double factor, double floor) {
+    const __m512d f = _mm512_set1_pd(factor);
+    const __m512d lo = _mm512_set1_pd(floor);
+    std::size_t floorHits = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d v = _mm512_mul_pd(_mm512_loadu_pd(values + i), f);
+        floorHits += __builtin_popcount(_mm512_cmp_pd_mask(v, lo, _CMP_LT_OQ));
+        _mm512_storeu_pd(values + i, _mm512_max_pd(v, lo));
+    }
+    return floorHits + evaporateScalar(values + i, n - i, factor, floor);
+}
+
+__attribute__((target("avx512f")))
+void depositAVX512(double* take, double* notTake, const std::uint64_t* bits, std::size_t n, double amount) {
+    const __m512d amt = _mm512_set1_pd(amount);
+    std::size_t done = 0;
+    for (; done + 64 <= n; done += 64) {
+        const std::uint64_t word = bits[done / 64];
+        for (std::size_t g = 0; g < 64; g += 8) {
+            // Cada byte da palavra já é a máscara dos 8 itens correspondentes
+            __mmask8 isTake = static_cast<__mmask8>(word >> g);
+            std::size_t i = done + g;
+            __m512d t = _mm512_loadu_pd(take + i);
+            __m512d nt = _mm512_loadu_pd(notTake + i);
+            _mm512_storeu_pd(take + i, _mm512_mask_add_pd(t, isTake, t, amt));
+            _mm512_storeu_pd(notTake + i, _mm512_mask_add_pd(nt, static_cast<__mmask8>(~isTake), nt, amt));
+        }
+    }
+    depositTail(take, notTake, bits, n, done, amount);
+}
+
+#endif // ACO_X86_KERNELS
+
+const PheromoneKernels kScalarKernels = {evaporateScalar, depositScalar, KernelIsa::Scalar, "scalar"};
+#ifdef ACO_X86_KERNELS
+const PheromoneKernels kSSE2Kernels = {evaporateSSE2, depositSSE2, KernelIsa::SSE2, "sse2"};
+const PheromoneKernels kAVX2Kernels = {evaporateAVX2, depositAVX2, KernelIsa::AVX2, "avx2"};
+const PheromoneKernels kAVX512Kernels = {evaporateAVX512, depositAVX512, KernelIsa::AVX512, "avx512"};
+#endif
+
+bool cpuSupports(KernelIsa isa) {
+#ifdef ACO_X86_KERNELS
+    switch (isa) {
+        case KernelIsa::Scalar: return true;
+        case KernelIsa::SSE2:   return __builtin_cpu_supports("sse2");
+        case KernelIsa::AVX2:   return __builtin_cpu_supports("avx2");
+        case KernelIsa::AVX512: return __builtin_cpu_supports("avx512f");
+    }
+    return false;
+#else
+    return isa == KernelIsa::Scalar;
+#endif
+}
+
+} // namespace
+
+const PheromoneKernels& pheromoneKernelsFor(KernelIsa isa) {
+    if (!cpuSupports(isa)) {
+        return kScalarKernels;
+    }
+#ifdef ACO_X86_KERNELS
+    switch (isa) {
+        case KernelIsa::SSE2:   return kSSE2Kernels;
+        case KernelIsa::AVX2:   return kAVX2Kernels;
+        case KernelIsa::AVX512: return kAVX512Kernels;
+        case KernelIsa::Scalar: break;
+    }
+#endif
+    return kScalarKernels;
+}
+
+const PheromoneKernels& selectPheromoneKernels() {
+    static const PheromoneKernels& selected = [] () -> const PheromoneKernels& {
+        for (KernelIsa isa : {KernelIsa::AVX512, KernelIsa::AVX2, KernelIsa::SSE2}) {
+            if (cpuSupports(isa)) {
+                return pheromoneKernelsFor(isa);
+            }
+        }
+        return kScalarKernels;
+    }();
+    return selected;
+}
+
+double pheromoneEntropy(const double* take, const double* notTake, std::size_t n) {
+    double total = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        double p = take[i] / (take[i] + notTake[i]);
+        if (p > 0.0 && p < 1.0) {
+            total -= p * std::log2(p) + (1.0 - p) * std::log2(1.0 - p);
+        }
+    }
+    return (n > 0) ? total / n : 0.0;
+}
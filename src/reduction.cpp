@@ -0,0 +1,155 @@
+#include "reduction.h"
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+namespace {
+
+// Índices em ordem decrescente de valor/peso (comparação cruzada, sem divisão; peso zero
+// fica na frente). No empate, menor índice primeiro, para a ordem ser determinística.
+std::vector<int> ratioOrder(const std::vector<Item>& items) {
+    std::vector<int> order(items.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&items](int a, int b) {
+        // Separado antes: na comparação cruzada um item (0, 0) empataria com todos e a ordem
+        // deixaria de ser estrita
+        bool freeA = (items[a].weight == 0);
+        bool freeB = (items[b].weight == 0);
+        if (freeA != freeB) {
+            return freeA;
+        }
+        long long lhs = static_cast<long long>(items[a].value) * items[b].weight;
+        long long rhs = static_cast<long long>(items[b].value) * items[a].weight;
+        return (lhs != rhs) ? lhs > rhs : a < b;
+    });
+    return order;
+}
+
+struct LinearRelaxation {
+    int criticalPosition;  // Posição do item crítico em order; order.size() se todos cabem
+    double bound;
+};
+
+LinearRelaxation solveRelaxation(int capacity, const std::vector<Item>& items, const std::vector<int>& order) {
+    LinearRelaxation relaxation{static_cast<int>(order.size()), 0.0};
+    long long remaining = capacity;
+    for (size_t k = 0; k < order.size(); ++k) {
+        const Item& item = items[order[k]];
+        if (item.weight <= remaining) {
+            remaining -= item.weight;
+            relaxation.bound += item.value;
+        } else {
+            relaxation.bound += static_cast<double>(item.value) * remaining / item.weight;
+            relaxation.criticalPosition = static_cast<int>(k);
+            break;
+        }
+    }
+    return relaxation;
+}
+
+} // namespace
+
+double dantzigUpperBound(int capacity, const std::vector<Item>& items) {
+    return solveRelaxation(capacity, items, ratioOrder(items)).bound;
+}
+
+ReducedInstance reduceInstance(int capacity, const std::vector<Item>& items) {
+    const std::vector<int> order = ratioOrder(items);
+    const LinearRelaxation relaxation = solveRelaxation(capacity, items, order);
+
+    ReducedInstance reduced;
+    reduced.numFixedOut = 0;
+    reduced.fixedValue = 0;
+    reduced.fixedWeight = 0;
+    reduced.upperBound = relaxation.bound;
+    reduced.criticalItem = (relaxation.criticalPosition < (int)order.size()) ? order[relaxation.criticalPosition] : -1;
+
+    // Solução gulosa: percorre a ordem por razão incluindo tudo o que ainda couber
+    reduced.lowerBound = 0;
+    std::vector<char> inGreedy(items.size(), 0);
+    long long remaining = capacity;
+    for (int idx : order) {
+        if (items[idx].weight <= remaining) {
+            remaining -= items[idx].weight;
+            reduced.lowerBound += items[idx].value;
+            inGreedy[idx] = 1;
+        }
+    }
+
+    // A gulosa já alcança o limite inteiro (comum em subset-sum): ela é ótima e não sobra núcleo
+    const bool greedyIsOptimal = reduced.lowerBound >= std::floor(relaxation.bound + 1e-9);
+
+    // Tolerância a favor de não fixar: um erro de arredondamento nunca fixa um item indevidamente
+    const double tolerance = 1e-9 * std::max(1.0, relaxation.bound);
+    const double criticalRatio = (reduced.criticalItem >= 0)
+        ? static_cast<double>(items[reduced.criticalItem].value) / items[reduced.criticalItem].weight
+        : 0.0;
+
+    for (size_t k = 0; k < order.size(); ++k) {
+        const int idx = order[k];
+        const Item& item = items[idx];
+        bool takenByRelaxation = static_cast<int>(k) < relaxation.criticalPosition;
+
+        bool fixIn = false;
+        bool fixOut = false;
+        if (reduced.criticalItem < 0) {
+            fixIn = true;  // Todos os itens cabem juntos
+        } else if (greedyIsOptimal) {
+            fixIn = inGreedy[idx] != 0;
+            fixOut = !fixIn;
+        } else if (item.weight > capacity) {
+            fixOut = true;
+        } else if (idx != reduced.criticalItem) {
+            double reducedCost = std::fabs(item.value - criticalRatio * item.weight);
+            bool provable = relaxation.bound - reducedCost < reduced.lowerBound - tolerance;
+            fixIn = provable && takenByRelaxation;
+            fixOut = provable && !takenByRelaxation;
+        }
+
+        if (fixIn) {
+            reduced.fixedIn.push_back(idx);
+            reduced.fixedValue += item.value;
+            reduced.fixedWeight += item.weight;
+        } else if (fixOut) {
+            ++reduced.numFixedOut;
+        } else {
+            reduced.coreToOriginal.push_back(idx);
+        }
+    }
+
+    // Núcleo na ordem original dos itens (a ordem por razão é só um detalhe da redução).
+    // Itens que não cabem ao lado dos fixados dentro também ficam de fora.
+    reduced.capacity = static_cast<int>(capacity - reduced.fixedWeight);
+    std::sort(reduced.coreToOriginal.begin(), reduced.coreToOriginal.end());
+    std::sort(reduced.fixedIn.begin(), reduced.fixedIn.end());
+    size_t kept = 0;
+    for (int idx : reduced.coreToOriginal) {
+        if (items[idx].weight > reduced.capacity) {
+            ++reduced.numFixedOut;
+            continue;
+        }
+        reduced.coreToOriginal[kept++] = idx;
+        reduced.coreItems.push_back(items[idx]);
+    }
+    reduced.coreToOriginal.resize(kept);
+    return reduced;
+}
+
+std::vector<int> expandSolution(const ReducedInstance& reduced, const std::vector<int>& coreSolution,
+                                std::size_t numItems) {
+    std::vector<int> solution(numItems, 0);
+    for (int idx : reduced.fixedIn) {
+        solution[idx] = 1;
+    }
+    for (size_t k = 0; k < coreSolution.size() && k < reduced.coreToOriginal.size(); ++k) {
+        if (coreSolution[k] == 1) {
+            solution[reduced.coreToOriginal[k]] = 1;
+        }
+    }
+    return solution;
+}
+
+double optimalityGap(long long value, double upperBound) {
+    double integerBound = std::floor(upperBound + 1e-9);
+    return (integerBound > 0.0) ? (integerBound - static_cast<double>(value)) / integerBound : 0.0;
+}
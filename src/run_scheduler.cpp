@@ -0,0 +1,130 @@
+#include "run_scheduler.h"
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+#include <memory>
+#include <time.h>   // clock_gettime(CLOCK_THREAD_CPUTIME_ID)
+
+namespace {
+
+// Faixa [begin, end) empacotada numa única palavra para permitir CAS
+std::uint64_t packRange(std::uint32_t begin, std::uint32_t end) {
+    return (static_cast<std::uint64_t>(end) << 32) | begin;
+}
+
+std::uint32_t rangeBegin(std::uint64_t range) {
+    return static_cast<std::uint32_t>(range);
+}
+
+std::uint32_t rangeEnd(std::uint64_t range) {
+    return static_cast<std::uint32_t>(range >> 32);
+}
+
+double threadCpuSeconds() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Alinhado à linha de cache para evitar falso compartilhamento entre threads
+struct alignas(64) WorkerRange {
+    std::atomic<std::uint64_t> range{0};
+};
+
+// O dono consome a partir do início da própria faixa
+bool popOwn(WorkerRange& own, int& runIndex) {
+    std::uint64_t current = own.range.load();
+    while (rangeBegin(current) < rangeEnd(current)) {
+        std::uint64_t next = packRange(rangeBegin(current) + 1, rangeEnd(current));
+        if (own.range.compare_exchange_weak(current, next)) {
+            runIndex = static_cast<int>(rangeBegin(current));
+            return true;
+        }
+    }
+    return false;
+}
+
+// Um ladrão leva a metade final da faixa da vítima
+bool stealHalf(WorkerRange& victim, std::uint32_t& stolenBegin, std::uint32_t& stolenEnd) {
+    std::uint64_t current = victim.range.load();
+    while (rangeBegin(current) < rangeEnd(current)) {
+        std::uint32_t begin = rangeBegin(current);
+        std::uint32_t end = rangeEnd(current);
+        std::uint32_t mid = begin + (end - begin) / 2;
+        if (victim.range.compare_exchange_weak(current, packRange(begin, mid))) {
+            stolenBegin = mid;
+            stolenEnd = end;
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+RunScheduler::RunScheduler(int numThreads) : numThreads_(numThreads) {
+    if (numThreads_ <= 0) {
+        numThreads_ = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+int RunScheduler::numThreads() const {
+    return numThreads_;
+}
+
+std::vector<RunTiming> RunScheduler::run(int numRuns, const std::function<void(int)>& job) const {
+    std::vector<RunTiming> timings(numRuns, RunTiming{0.0, 0.0});
+    if (numRuns <= 0) {
+        return timings;
+    }
+
+    int workers = std::min(numThreads_, numRuns);
+    std::unique_ptr<WorkerRange[]> ranges(new WorkerRange[workers]);
+    for (int w = 0; w < workers; ++w) {
+        std::uint32_t begin = static_cast<std::uint32_t>(static_cast<long long>(numRuns) * w / workers);
+        std::uint32_t end = static_cast<std::uint32_t>(static_cast<long long>(numRuns) * (w + 1) / workers);
+        ranges[w].range.store(packRange(begin, end));
+    }
+
+    auto workerBody = [&](int w) {
+        int runIndex = 0;
+        while (true) {
+            while (popOwn(ranges[w], runIndex)) {
+                auto wallStart = std::chrono::steady_clock::now();
+                double cpuStart = threadCpuSeconds();
+
+                job(runIndex);
+
+                double cpuEnd = threadCpuSeconds();
+                std::chrono::duration<double> wall = std::chrono::steady_clock::now() - wallStart;
+                timings[runIndex] = RunTiming{wall.count(), cpuEnd - cpuStart};
+            }
+
+            // Faixa própria vazia: tenta roubar de outra thread
+            bool stole = false;
+            for (int offset = 1; offset < workers && !stole; ++offset) {
+                std::uint32_t begin = 0, end = 0;
+                if (stealHalf(ranges[(w + offset) % workers], begin, end)) {
+                    ranges[w].range.store(packRange(begin, end));
+                    stole = true;
+                }
+            }
+            if (!stole) {
+                return;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int w = 1; w < workers; ++w) {
+        threads.emplace_back(workerBody, w);
+    }
+    workerBody(0);
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    return timings;
+}
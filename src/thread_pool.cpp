@@ -0,0 +1,79 @@
+#include "thread_pool.h"
+
+ThreadPool::ThreadPool(int numThreads)
+    : task_(nullptr), taskCount_(0), nextTask_(0), activeWorkers_(0),
+      generation_(0), stopping_(false) {
+    for (int worker = 1; worker < numThreads; ++worker) {
+        workers_.emplace_back(&ThreadPool::workerLoop, this, worker);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wakeWorkers_.notify_all();
+    for (std::thread& t : workers_) {
+        t.join();
+    }
+}
+
+int ThreadPool::size() const {
+    return static_cast<int>(workers_.size()) + 1;
+}
+
+void ThreadPool::runTasks(int worker) {
+    for (int i = nextTask_.fetch_add(1); i < taskCount_; i = nextTask_.fetch_add(1)) {
+        (*task_)(i, worker);
+    }
+}
+
+void ThreadPool::parallelFor(int count, const std::function<void(int, int)>& task) {
+    if (workers_.empty()) {
+        for (int i = 0; i < count; ++i) {
+            task(i, 0);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        taskCount_ = count;
+        nextTask_.store(0);
+        activeWorkers_ = static_cast<int>(workers_.size());
+        ++generation_;
+    }
+    wakeWorkers_.notify_all();
+
+    // A thread chamadora também trabalha enquanto espera
+    runTasks(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    workDone_.wait(lock, [this] { return activeWorkers_ == 0; });
+    task_ = nullptr;
+}
+
+void ThreadPool::workerLoop(int worker) {
+    unsigned long seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wakeWorkers_.wait(lock, [&] { return stopping_ || generation_ != seenGeneration; });
+            if (stopping_) {
+                return;
+            }
+            seenGeneration = generation_;
+        }
+
+        runTasks(worker);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--activeWorkers_ == 0) {
+                workDone_.notify_one();
+            }
+        }
+    }
+}
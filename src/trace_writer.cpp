@@ -0,0 +1,204 @@
+#include "trace_writer.h"
+#include <cstring>
+#include <chrono>
+
+namespace {
+
+const char kTraceMagic[8] = {'A', 'C', 'O', 'T', 'R', 'C', '0', '1'};
+
+TraceColumnDescriptor column(const char* name, char type, std::uint8_t size) {
+    TraceColumnDescriptor descriptor;
+    std::memset(&descriptor, 0, sizeof(descriptor));
+    std::strncpy(descriptor.name, name, sizeof(descriptor.name) - 1);
+    descriptor.type = type;
+    descriptor.size = size;
+    return descriptor;
+}
+
+// Mesma ordem em que flushBlock() grava as colunas
+const TraceColumnDescriptor kColumns[] = {
+    column("execucao", 'u', 4),
+    column("iteracao", 'u', 4),
+    column("melhor", 'i', 4),
+    column("pior", 'i', 4),
+    column("melhor_global", 'i', 4),
+    column("media", 'f', 8),
+    column("entropia", 'f', 8),
+    column("tempo_s", 'f', 8),
+};
+
+template <typename T>
+void writeColumn(std::ofstream& file, const std::vector<T>& values) {
+    file.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+} // namespace
+
+TraceWriter::TraceWriter()
+    : mask_(0), enqueuePosition_(0), dequeuePosition_(0), stopping_(false), written_(0), dropped_(0) {}
+
+TraceWriter::~TraceWriter() {
+    close();
+}
+
+bool TraceWriter::open(const std::string& filePath, std::string& error, std::size_t ringCapacity) {
+    close();
+    file_.open(filePath, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+        error = "Erro ao abrir o arquivo de traço para escrita: " + filePath;
+        return false;
+    }
+
+    TraceFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kTraceMagic, sizeof(kTraceMagic));
+    header.version = 1;
+    header.numColumns = sizeof(kColumns) / sizeof(kColumns[0]);
+    file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file_.write(reinterpret_cast<const char*>(kColumns), sizeof(kColumns));
+
+    std::size_t capacity = 2;
+    while (capacity < ringCapacity) {
+        capacity <<= 1;
+    }
+    cells_.reset(new Cell[capacity]);
+    for (std::size_t i = 0; i < capacity; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    mask_ = capacity - 1;
+    enqueuePosition_.store(0, std::memory_order_relaxed);
+    dequeuePosition_ = 0;
+    written_.store(0, std::memory_order_relaxed);
+    dropped_.store(0, std::memory_order_relaxed);
+    stopping_.store(false, std::memory_order_relaxed);
+
+    runColumn_.reserve(kBlockRows);
+    iterationColumn_.reserve(kBlockRows);
+    bestColumn_.reserve(kBlockRows);
+    worstColumn_.reserve(kBlockRows);
+    bestSoFarColumn_.reserve(kBlockRows);
+    meanColumn_.reserve(kBlockRows);
+    entropyColumn_.reserve(kBlockRows);
+    elapsedColumn_.reserve(kBlockRows);
+
+    writer_ = std::thread(&TraceWriter::writerLoop, this);
+    return true;
+}
+
+bool TraceWriter::record(const TraceRecord& record) {
+    // Cada célula guarda a posição em que pode ser escrita; quem ganhar o CAS fica com ela
+    std::uint64_t position = enqueuePosition_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &cells_[position & mask_];
+        std::uint64_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::int64_t difference = static_cast<std::int64_t>(sequence - position);
+        if (difference == 0) {
+            if (enqueuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);  // Anel cheio: a thread de escrita não acompanhou
+            return false;
+        } else {
+            position = enqueuePosition_.load(std::memory_order_relaxed);
+        }
+    }
+    cell->record = record;
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+bool TraceWriter::pop(TraceRecord& record) {
+    Cell& cell = cells_[dequeuePosition_ & mask_];
+    if (cell.sequence.load(std::memory_order_acquire) != dequeuePosition_ + 1) {
+        return false;
+    }
+    record = cell.record;
+    cell.sequence.store(dequeuePosition_ + mask_ + 1, std::memory_order_release);
+    ++dequeuePosition_;
+    return true;
+}
+
+void TraceWriter::writerLoop() {
+    TraceRecord record;
+    for (;;) {
+        // stopping_ é lido antes de esvaziar: o que foi gravado antes de close() sai nesta passada
+        bool stopping = stopping_.load(std::memory_order_acquire);
+        std::size_t drained = 0;
+        while (pop(record)) {
+            appendRow(record);
+            ++drained;
+        }
+        if (stopping) {
+            break;
+        }
+        // Acordar a cada poucos milissegundos custa mais às threads de solve() do que o próprio
+        // record(); só volta logo se a última passada encontrou o anel mais de um quarto cheio
+        if (drained <= (mask_ + 1) / 4) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(kSleepMilliseconds));
+        }
+    }
+    flushBlock();
+    file_.flush();
+}
+
+void TraceWriter::appendRow(const TraceRecord& record) {
+    runColumn_.push_back(record.run);
+    iterationColumn_.push_back(record.iteration);
+    bestColumn_.push_back(record.bestValue);
+    worstColumn_.push_back(record.worstValue);
+    bestSoFarColumn_.push_back(record.bestSoFar);
+    meanColumn_.push_back(record.meanValue);
+    entropyColumn_.push_back(record.entropy);
+    elapsedColumn_.push_back(record.elapsedSeconds);
+    if (runColumn_.size() == kBlockRows) {
+        flushBlock();
+    }
+}
+
+void TraceWriter::flushBlock() {
+    if (runColumn_.empty()) {
+        return;
+    }
+    TraceBlockHeader block;
+    block.rowCount = static_cast<std::uint32_t>(runColumn_.size());
+    block.reserved = 0;
+    file_.write(reinterpret_cast<const char*>(&block), sizeof(block));
+    writeColumn(file_, runColumn_);
+    writeColumn(file_, iterationColumn_);
+    writeColumn(file_, bestColumn_);
+    writeColumn(file_, worstColumn_);
+    writeColumn(file_, bestSoFarColumn_);
+    writeColumn(file_, meanColumn_);
+    writeColumn(file_, entropyColumn_);
+    writeColumn(file_, elapsedColumn_);
+    written_.fetch_add(block.rowCount, std::memory_order_relaxed);
+
+    runColumn_.clear();
+    iterationColumn_.clear();
+    bestColumn_.clear();
+    worstColumn_.clear();
+    bestSoFarColumn_.clear();
+    meanColumn_.clear();
+    entropyColumn_.clear();
+    elapsedColumn_.clear();
+}
+
+void TraceWriter::close() {
+    if (writer_.joinable()) {
+        stopping_.store(true, std::memory_order_release);
+        writer_.join();
+    }
+    if (file_.is_open()) {
+        file_.close();
+    }
+}
+
+std::uint64_t TraceWriter::written() const {
+    return written_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t TraceWriter::dropped() const {
+    return dropped_.load(std::memory_order_relaxed);
+}
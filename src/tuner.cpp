@@ -0,0 +1,410 @@
+#include "tuner.h"
+#include "aco.h"
+#include "run_scheduler.h"
+#include "instance_generator.h"
+#include "rng.h"
+#include <algorithm>
+#include <random>
+#include <cmath>
+#include <chrono>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+
+namespace {
+
+// Grade de onde as candidatas são sorteadas
+const int kAntGrid[] = {10, 20, 30, 50, 75, 100, 150};
+const double kEvaporationGrid[] = {0.05, 0.1, 0.15, 0.2, 0.3, 0.4, 0.5, 0.7};
+const double kAlphaGrid[] = {0.5, 0.75, 1.0, 1.25, 1.5, 2.0, 2.5, 3.0};
+const double kBetaGrid[] = {1.0, 1.5, 2.0, 2.5, 3.0, 4.0, 5.0, 6.0};
+
+template <typename T, std::size_t N>
+constexpr std::size_t gridSize(const T (&)[N]) {
+    return N;
+}
+
+bool sameConfig(const ParameterConfig& a, const ParameterConfig& b) {
+    return a.numAnts == b.numAnts && a.evaporationRate == b.evaporationRate && a.alpha == b.alpha && a.beta == b.beta;
+}
+
+std::vector<ParameterConfig> sampleCandidates(const TunerConfig& config) {
+    const std::size_t gridPoints = gridSize(kAntGrid) * gridSize(kEvaporationGrid) * gridSize(kAlphaGrid) * gridSize(kBetaGrid);
+    const std::size_t wanted = std::min<std::size_t>(std::max(config.numConfigurations, 2), gridPoints + 1);
+
+    std::vector<ParameterConfig> candidates = {config.baseline};
+    std::mt19937 rng(config.seed);
+    for (std::size_t attempt = 0; candidates.size() < wanted && attempt < 100 * wanted; ++attempt) {
+        ParameterConfig candidate;
+        candidate.numAnts = kAntGrid[rng() % gridSize(kAntGrid)];
+        candidate.evaporationRate = kEvaporationGrid[rng() % gridSize(kEvaporationGrid)];
+        candidate.alpha = kAlphaGrid[rng() % gridSize(kAlphaGrid)];
+        candidate.beta = kBetaGrid[rng() % gridSize(kBetaGrid)];
+        bool known = std::any_of(candidates.begin(), candidates.end(),
+                                 [&](const ParameterConfig& c) { return sameConfig(c, candidate); });
+        if (!known) {
+            candidates.push_back(candidate);
+        }
+    }
+    return candidates;
+}
+
+// Quantil da normal padrão (aproximação racional de Acklam, erro relativo < 1.2e-9)
+double normalQuantile(double p) {
+    static const double a[] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                               1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00};
+    static const double b[] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                               6.680131188771972e+01, -1.328068155288572e+01};
+    static const double c[] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                               -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00};
+    static const double d[] = {7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+                               3.754408661907416e+00};
+    const double low = 0.02425;
+    if (p < low) {
+        double q = std::sqrt(-2.0 * std::log(p));
+        return (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+               ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    }
+    if (p > 1.0 - low) {
+        return -normalQuantile(1.0 - p);
+    }
+    double q = p - 0.5;
+    double r = q * q;
+    return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+           (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+}
+
+// Quantil da qui-quadrado. Com df = 1 (duas candidatas vivas) ela é o quadrado de uma normal e
+// com df = 2 uma exponencial de média 2, ambas com forma fechada. A partir de df = 3 vale
+// Wilson-Hilferty (erro abaixo de 0.6% em p = 0.95), que em df = 1 daria 3.75 no lugar de 3.84.
+double chiSquareQuantile(double p, int df) {
+    if (df == 1) {
+        double z = normalQuantile(0.5 + p / 2.0);
+        return z * z;
+    }
+    if (df == 2) {
+        return -2.0 * std::log(1.0 - p);
+    }
+    double z = normalQuantile(p);
+    double h = 2.0 / (9.0 * df);
+    double base = 1.0 - h + z * std::sqrt(h);
+    return df * base * base * base;
+}
+
+// Quantil da t de Student (expansão de Cornish-Fisher, Abramowitz & Stegun 26.7.5)
+double studentTQuantile(double p, int df) {
+    double z = normalQuantile(p);
+    double z2 = z * z;
+    double n = static_cast<double>(df);
+    double g1 = (z2 + 1.0) * z / 4.0;
+    double g2 = ((5.0 * z2 + 16.0) * z2 + 3.0) * z / 96.0;
+    double g3 = (((3.0 * z2 + 19.0) * z2 + 17.0) * z2 - 15.0) * z / 384.0;
+    double g4 = ((((79.0 * z2 + 776.0) * z2 + 1482.0) * z2 - 1920.0) * z2 - 945.0) * z / 92160.0;
+    return z + g1 / n + g2 / (n * n) + g3 / (n * n * n) + g4 / (n * n * n * n);
+}
+
+// Soma dos postos de cada candidata viva nos blocos [0, blocks): posto 1 = maior valor no bloco,
+// empates recebem a média dos postos. sumSquares recebe a soma dos quadrados de todos os postos.
+std::vector<double> rankSums(const std::vector<std::vector<int>>& values, const std::vector<int>& alive, int blocks,
+                             double& sumSquares) {
+    const std::size_t k = alive.size();
+    std::vector<double> sums(k, 0.0);
+    std::vector<int> order(k);
+    sumSquares = 0.0;
+    for (int block = 0; block < blocks; ++block) {
+        for (std::size_t j = 0; j < k; ++j) {
+            order[j] = static_cast<int>(j);
+        }
+        std::sort(order.begin(), order.end(), [&](int x, int y) {
+            return values[alive[x]][block] > values[alive[y]][block];
+        });
+        for (std::size_t first = 0; first < k;) {
+            std::size_t last = first + 1;
+            while (last < k && values[alive[order[last]]][block] == values[alive[order[first]]][block]) {
+                ++last;
+            }
+            double rank = (first + 1 + last) / 2.0;  // Média dos postos first+1 .. last
+            for (std::size_t j = first; j < last; ++j) {
+                sums[order[j]] += rank;
+                sumSquares += rank * rank;
+            }
+            first = last;
+        }
+    }
+    return sums;
+}
+
+SolveResult runCandidate(const ParameterConfig& parameters, const TuningInstance& instance, unsigned int seed,
+                         int antEvaluations, int targetValue) {
+    int maxIterations = std::max(1, antEvaluations / parameters.numAnts);
+    ACO aco(parameters.numAnts, parameters.evaporationRate, parameters.alpha, parameters.beta,
+            instance.capacity, instance.items, maxIterations, seed);
+    SolveLimits limits;
+    limits.targetValue = targetValue;
+    return aco.solve(limits);
+}
+
+// Percentil pelo posto mais próximo sobre valores já ordenados
+double percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    std::size_t rank = static_cast<std::size_t>(std::ceil(fraction * sorted.size()));
+    return sorted[std::min(std::max<std::size_t>(rank, 1), sorted.size()) - 1];
+}
+
+ValidationStats validate(const ParameterConfig& parameters, const std::vector<TuningInstance>& instances,
+                         const std::vector<int>& reference, const std::vector<unsigned int>& seeds,
+                         const TunerConfig& config, const RunScheduler& scheduler) {
+    const int runsPerInstance = static_cast<int>(seeds.size());
+    const int numRuns = static_cast<int>(instances.size()) * runsPerInstance;
+    std::vector<SolveResult> results(numRuns);
+    scheduler.run(numRuns, [&](int run) {
+        int instance = run / runsPerInstance;
+        results[run] = runCandidate(parameters, instances[instance], seeds[run % runsPerInstance],
+                                    config.antEvaluations, reference[instance]);
+    });
+
+    ValidationStats stats;
+    stats.runs = numRuns;
+    std::vector<double> quality;
+    std::vector<double> seconds;
+    std::vector<double> iterations;
+    for (int run = 0; run < numRuns; ++run) {
+        const SolveResult& result = results[run];
+        int ref = reference[run / runsPerInstance];
+        quality.push_back(ref > 0 ? static_cast<double>(result.bestValue) / ref : 1.0);
+        if (result.stopReason == StopReason::TargetReached) {
+            seconds.push_back(result.elapsedSeconds);
+            iterations.push_back(result.iterations);
+        }
+    }
+    if (numRuns == 0) {
+        return stats;
+    }
+    std::sort(quality.begin(), quality.end());
+    std::sort(seconds.begin(), seconds.end());
+    std::sort(iterations.begin(), iterations.end());
+    stats.qualityMin = quality.front();
+    stats.qualityP10 = percentile(quality, 0.10);
+    stats.qualityMedian = percentile(quality, 0.50);
+    for (double q : quality) {
+        stats.qualityMean += q / numRuns;
+    }
+    stats.qualityMax = quality.back();
+    stats.targetHitRate = static_cast<double>(seconds.size()) / numRuns;
+    stats.timeToTargetMedian = percentile(seconds, 0.50);
+    stats.timeToTargetP90 = percentile(seconds, 0.90);
+    stats.iterationsToTargetMedian = percentile(iterations, 0.50);
+    return stats;
+}
+
+std::string describe(const ParameterConfig& p) {
+    std::ostringstream text;
+    text << "formigas=" << p.numAnts << " evaporacao=" << p.evaporationRate << " alfa=" << p.alpha
+         << " beta=" << p.beta;
+    return text.str();
+}
+
+} // namespace
+
+FriedmanOutcome friedmanConover(const std::vector<std::vector<int>>& values, const std::vector<int>& alive,
+                                int blocks, double confidence) {
+    FriedmanOutcome outcome;
+    const int k = static_cast<int>(alive.size());
+    const int b = blocks;
+    if (k < 2 || b < 2) {
+        return outcome;
+    }
+
+    double sumSquares = 0.0;  // A na notação de Conover
+    outcome.rankSums = rankSums(values, alive, blocks, sumSquares);
+    const std::vector<double>& sums = outcome.rankSums;
+    const double tieCorrection = b * k * (k + 1.0) * (k + 1.0) / 4.0;  // C
+    const double spread = sumSquares - tieCorrection;
+    if (spread <= 1e-12) {
+        return outcome;  // Todas empatadas em todos os blocos
+    }
+
+    double deviation = 0.0;
+    double sumRankSquares = 0.0;
+    for (double r : sums) {
+        deviation += (r - b * (k + 1.0) / 2.0) * (r - b * (k + 1.0) / 2.0);
+        sumRankSquares += r * r;
+    }
+    outcome.statistic = (k - 1.0) * deviation / spread;
+    if (outcome.statistic <= chiSquareQuantile(confidence, k - 1)) {
+        return outcome;
+    }
+
+    // |Ri - Rj| > t * sqrt(2 (b A - soma Rj^2) / ((b - 1)(k - 1))). O fator (1 - T / (b (k - 1)))
+    // das formas com T já está embutido em A - soma Rj^2 / b e não entra de novo.
+    const int df = (b - 1) * (k - 1);
+    outcome.criticalDifference = studentTQuantile(1.0 - (1.0 - confidence) / 2.0, df) *
+                                 std::sqrt(2.0 * b * std::max(0.0, sumSquares - sumRankSquares / b) / df);
+    double bestSum = *std::min_element(sums.begin(), sums.end());
+    for (int j = 0; j < k; ++j) {
+        if (sums[j] - bestSum > outcome.criticalDifference) {
+            outcome.discarded.push_back(j);
+        }
+    }
+    return outcome;
+}
+
+TuningResult raceParameters(const std::vector<TuningInstance>& instances, const TunerConfig& config,
+                            std::ostream& log) {
+    auto start = std::chrono::steady_clock::now();
+    TuningResult result;
+    std::vector<ParameterConfig> candidates = sampleCandidates(config);
+    result.candidates = static_cast<int>(candidates.size());
+    result.best = config.baseline;
+    if (instances.empty()) {
+        return result;
+    }
+
+    RunScheduler scheduler(config.numThreads);
+    const int numInstances = static_cast<int>(instances.size());
+    const int minBlocks = std::max(config.minBlocks, 2);
+    std::vector<std::vector<int>> values(candidates.size());  // values[candidata][bloco]
+    std::vector<unsigned int> blockSeeds;
+    std::vector<int> reference(numInstances, 0);  // Melhor valor visto em cada instância
+    std::vector<int> alive(candidates.size());
+    for (std::size_t c = 0; c < candidates.size(); ++c) {
+        alive[c] = static_cast<int>(c);
+    }
+    std::uint64_t seedState = config.seed;
+
+    while (alive.size() > 1) {
+        // Com poucas vivas, vários blocos por rodada mantêm todas as threads ocupadas
+        const int k = static_cast<int>(alive.size());
+        int roundBlocks = (result.blocks < minBlocks) ? minBlocks - result.blocks
+                                                      : std::max(1, (scheduler.numThreads() + k - 1) / k);
+        roundBlocks = static_cast<int>(std::min<long long>(roundBlocks, (config.evaluationBudget - result.evaluations) / k));
+        if (roundBlocks <= 0) {
+            break;
+        }
+
+        const int firstBlock = result.blocks;
+        for (int r = 0; r < roundBlocks; ++r) {
+            blockSeeds.push_back(static_cast<unsigned int>(splitMix64(seedState)));
+        }
+        for (int c : alive) {
+            values[c].resize(firstBlock + roundBlocks);
+        }
+        // Cada tarefa grava em values[candidata][bloco] próprio, então não há disputa na coleta
+        scheduler.run(roundBlocks * k, [&](int task) {
+            int block = firstBlock + task / k;
+            int candidate = alive[task % k];
+            SolveResult run = runCandidate(candidates[candidate], instances[block % numInstances], blockSeeds[block],
+                                           config.antEvaluations, 0);
+            values[candidate][block] = run.bestValue;
+        });
+        result.blocks += roundBlocks;
+        result.evaluations += static_cast<long long>(roundBlocks) * k;
+        for (int block = firstBlock; block < result.blocks; ++block) {
+            for (int c : alive) {
+                reference[block % numInstances] = std::max(reference[block % numInstances], values[c][block]);
+            }
+        }
+
+        if (result.blocks < minBlocks) {
+            continue;
+        }
+        FriedmanOutcome test = friedmanConover(values, alive, result.blocks, config.confidence);
+        const std::vector<int>& discarded = test.discarded;
+        if (discarded.empty()) {
+            continue;
+        }
+        std::vector<int> kept;
+        for (int j = 0; j < k; ++j) {
+            if (!std::binary_search(discarded.begin(), discarded.end(), j)) {
+                kept.push_back(alive[j]);
+            }
+        }
+        log << "Blocos " << result.blocks << ": " << k << " -> " << kept.size() << " configuracoes (Friedman T = "
+            << std::fixed << std::setprecision(2) << test.statistic << ", " << result.evaluations << " execucoes)"
+            << std::endl;
+        alive.swap(kept);
+    }
+
+    // Vivas da melhor soma de postos para a pior; empates ficam na ordem original (base primeiro)
+    double sumSquares = 0.0;
+    std::vector<double> sums = rankSums(values, alive, result.blocks, sumSquares);
+    std::vector<int> order(alive.size());
+    for (std::size_t j = 0; j < order.size(); ++j) {
+        order[j] = static_cast<int>(j);
+    }
+    std::stable_sort(order.begin(), order.end(), [&](int x, int y) { return sums[x] < sums[y]; });
+    for (int j : order) {
+        result.survivors.push_back(candidates[alive[j]]);
+    }
+    result.best = result.survivors.front();
+    result.raceSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    log << "Corrida encerrada apos " << result.blocks << " blocos e " << result.evaluations << " execucoes; melhor: "
+        << describe(result.best) << std::endl;
+
+    // Validação com seeds novas, as mesmas para a melhor e para a base
+    std::vector<unsigned int> validationSeeds(std::max(config.validationRuns, 0));
+    for (unsigned int& seed : validationSeeds) {
+        seed = static_cast<unsigned int>(splitMix64(seedState));
+    }
+    if (!validationSeeds.empty()) {
+        result.bestStats = validate(result.best, instances, reference, validationSeeds, config, scheduler);
+        result.baselineStats = sameConfig(result.best, config.baseline)
+                                   ? result.bestStats
+                                   : validate(config.baseline, instances, reference, validationSeeds, config, scheduler);
+    }
+    return result;
+}
+
+bool loadTuningInstances(const std::string& list, unsigned int seed, std::vector<TuningInstance>& instances,
+                         std::string& error) {
+    instances.clear();
+    std::stringstream ss(list);
+    std::string entry;
+    while (std::getline(ss, entry, ',')) {
+        if (entry.empty()) {
+            continue;
+        }
+        std::size_t colon = entry.find(':');
+        InstanceClass instanceClass;
+        if (colon != std::string::npos && parseInstanceClass(entry.substr(0, colon), instanceClass)) {
+            std::string sizes = entry.substr(colon + 1);
+            std::size_t second = sizes.find(':');
+            int numItems = 0;
+            int count = 4;
+            try {
+                numItems = std::stoi(sizes.substr(0, second));
+                if (second != std::string::npos) {
+                    count = std::stoi(sizes.substr(second + 1));
+                }
+            } catch (const std::exception&) {
+                error = "Esperado classe:n[:k] em " + entry;
+                return false;
+            }
+            if (numItems <= 0 || count <= 0) {
+                error = "Esperado classe:n[:k] com n e k positivos em " + entry;
+                return false;
+            }
+            for (int i = 0; i < count; ++i) {
+                unsigned int instanceSeed = seed + static_cast<unsigned int>(instances.size()) * 7919u;
+                std::pair<int, std::vector<Item>> generated = generateInstance(instanceClass, numItems, instanceSeed);
+                instances.push_back({entry + "#" + std::to_string(i + 1), generated.first, std::move(generated.second)});
+            }
+            continue;
+        }
+
+        TuningInstance instance;
+        instance.name = entry;
+        if (!loadKnapsackInstance(entry, instance.capacity, instance.items, error)) {
+            return false;
+        }
+        instances.push_back(std::move(instance));
+    }
+    if (instances.empty()) {
+        error = "Nenhuma instancia de treino";
+        return false;
+    }
+    return true;
+}
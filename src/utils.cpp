@@ -4,27 +4,406 @@
 #include <sstream>
 #include <vector>
 #include <string>
+#include <algorithm>
+#include <cstring>
+#include <climits>
+#include <cerrno>
+#include <fcntl.h>     // open
+#include <unistd.h>    // close
+#include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // fstat
 
-std::pair<int, std::vector<Item>> readKnapsackInstance(const std::string& filename) {
+namespace {
 
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Erro ao abrir o arquivo: " << filename << std::endl;
-        return {0, {}};
+const char kBinaryMagic[8] = {'A', 'C', 'O', 'K', 'N', 'A', 'P', '1'};
+
+// Mapeia um arquivo inteiro somente para leitura
+bool mapFile(const std::string& filePath, void*& data, std::size_t& size, std::string& error) {
+    data = nullptr;
+    size = 0;
+
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "Erro ao abrir o arquivo: " + filePath + " (" + std::strerror(errno) + ")";
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        error = "Erro ao obter o tamanho do arquivo: " + filePath;
+        ::close(fd);
+        return false;
+    }
+    if (st.st_size == 0) {
+        error = "Arquivo vazio: " + filePath;
+        ::close(fd);
+        return false;
+    }
+
+    size = static_cast<std::size_t>(st.st_size);
+    data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // O mapeamento continua válido depois de fechar o descritor
+    if (data == MAP_FAILED) {
+        data = nullptr;
+        error = "Erro ao mapear o arquivo: " + filePath;
+        return false;
+    }
+    madvise(data, size, MADV_SEQUENTIAL);
+    return true;
+}
+
+bool isBinaryInstance(const void* data, std::size_t size) {
+    return size >= sizeof(BinaryInstanceHeader) && std::memcmp(data, kBinaryMagic, sizeof(kBinaryMagic)) == 0;
+}
+
+// Leitor de inteiros escrito à mão sobre o texto mapeado, contando linhas para as mensagens de erro
+class IntegerScanner {
+public:
+    IntegerScanner(const char* begin, const char* end) : pos_(begin), end_(end), line_(1) {}
+
+    // Lê o próximo inteiro; retorna false no fim do arquivo ou se encontrar algo inválido
+    bool next(long long& value, std::string& error, const char* what) {
+        skipWhitespace();
+        if (pos_ == end_) {
+            error = std::string("Fim inesperado do arquivo ao ler ") + what + " (linha " + std::to_string(line_) + ")";
+            return false;
+        }
+
+        bool negative = false;
+        if (*pos_ == '-' || *pos_ == '+') {
+            negative = (*pos_ == '-');
+            ++pos_;
+        }
+        if (pos_ == end_ || *pos_ < '0' || *pos_ > '9') {
+            error = std::string("Valor inválido ao ler ") + what + " (linha " + std::to_string(line_) + ")";
+            return false;
+        }
+
+        long long result = 0;
+        while (pos_ != end_ && *pos_ >= '0' && *pos_ <= '9') {
+            int digit = *pos_ - '0';
+            if (result > (LLONG_MAX - digit) / 10) {
+                error = std::string("Número grande demais em ") + what + " (linha " + std::to_string(line_) + ")";
+                return false;
+            }
+            result = result * 10 + digit;
+            ++pos_;
+        }
+        if (pos_ != end_ && !isWhitespace(*pos_)) {
+            error = std::string("Caractere inesperado após ") + what + " (linha " + std::to_string(line_) + ")";
+            return false;
+        }
+
+        value = negative ? -result : result;
+        return true;
+    }
+
+    // Verdadeiro se só restam espaços em branco
+    bool atEnd() {
+        skipWhitespace();
+        return pos_ == end_;
+    }
+
+    int line() const { return line_; }
+
+    // Bytes ainda não lidos
+    std::size_t remaining() const { return static_cast<std::size_t>(end_ - pos_); }
+
+private:
+    static bool isWhitespace(char c) {
+        return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    }
+
+    void skipWhitespace() {
+        while (pos_ != end_ && isWhitespace(*pos_)) {
+            if (*pos_ == '\n') {
+                ++line_;
+            }
+            ++pos_;
+        }
+    }
+
+    const char* pos_;
+    const char* end_;
+    int line_;
+};
+
+bool readIntInRange(IntegerScanner& scanner, int& out, long long minValue, std::string& error, const char* what) {
+    long long value = 0;
+    if (!scanner.next(value, error, what)) {
+        return false;
+    }
+    if (value < minValue || value > INT_MAX) {
+        error = std::string("Valor fora do intervalo em ") + what + ": " + std::to_string(value) +
+                " (linha " + std::to_string(scanner.line()) + ")";
+        return false;
     }
+    out = static_cast<int>(value);
+    return true;
+}
+
+bool parseTextInstance(const char* begin, const char* end, int& capacity, std::vector<Item>& items,
+                       std::string& error) {
+    IntegerScanner scanner(begin, end);
 
     int numItems = 0;
-    file >> numItems;
+    if (!readIntInRange(scanner, numItems, 0, error, "o número de itens")) {
+        return false;
+    }
+    if (!readIntInRange(scanner, capacity, 0, error, "a capacidade")) {
+        return false;
+    }
 
-    int capacity = 0;
-    file >> capacity;
+    // Cada item ocupa pelo menos 4 bytes ("v p" e um separador; o último pode dispensar o
+    // separador): um número de itens maior que isso é erro, não uma reserva de vários GB
+    if (static_cast<std::size_t>(numItems) > (scanner.remaining() + 1) / 4) {
+        error = "O arquivo não comporta os " + std::to_string(numItems) + " itens declarados (" +
+                std::to_string(scanner.remaining()) + " bytes restantes)";
+        return false;
+    }
 
-    std::vector<Item> items(numItems);
+    items.clear();
+    items.reserve(numItems);
     for (int i = 0; i < numItems; ++i) {
-        items[i].id = i;
-        file >> items[i].value >> items[i].weight;
+        Item item;
+        item.id = i;
+        // Peso zero é aceito, como sempre foi: as ordenações por razão põem esses itens na frente
+        if (!readIntInRange(scanner, item.value, 0, error, "o valor de um item") ||
+            !readIntInRange(scanner, item.weight, 0, error, "o peso de um item")) {
+            error += " [item " + std::to_string(i) + " de " + std::to_string(numItems) + "]";
+            return false;
+        }
+        items.push_back(item);
+    }
+
+    if (!scanner.atEnd()) {
+        error = "Dados além dos " + std::to_string(numItems) + " itens declarados (linha " +
+                std::to_string(scanner.line()) + ")";
+        return false;
     }
+    return true;
+}
+
+bool validateBinaryHeader(const BinaryInstanceHeader& header, std::size_t fileSize, std::string& error) {
+    if (header.version != 1) {
+        error = "Versão do formato binário não suportada: " + std::to_string(header.version);
+        return false;
+    }
+    if (header.recordSize != sizeof(Item)) {
+        error = "Tamanho de registro inesperado no formato binário: " + std::to_string(header.recordSize);
+        return false;
+    }
+    if (header.capacity < 0 || header.capacity > INT_MAX || header.numItems > static_cast<std::uint64_t>(INT_MAX)) {
+        error = "Cabeçalho binário com capacidade ou número de itens fora do intervalo";
+        return false;
+    }
+    if (fileSize != sizeof(BinaryInstanceHeader) + header.numItems * sizeof(Item)) {
+        error = "Tamanho do arquivo binário não corresponde a " + std::to_string(header.numItems) + " itens";
+        return false;
+    }
+    return true;
+}
+
+// Mesmas regras do formato texto (valor e peso >= 0), totais iguais aos do cabeçalho e ids
+// distintos (o warm start e os checkpoints identificam os itens por Item::id)
+bool validateBinaryRecords(const BinaryInstanceHeader& header, const Item* records, std::string& error) {
+    std::int64_t totalValue = 0;
+    std::int64_t totalWeight = 0;
+    for (std::uint64_t i = 0; i < header.numItems; ++i) {
+        if (records[i].value < 0 || records[i].weight < 0) {
+            error = "Item " + std::to_string(i) + " com valor ou peso fora do intervalo (valor " +
+                    std::to_string(records[i].value) + ", peso " + std::to_string(records[i].weight) + ")";
+            return false;
+        }
+        totalValue += records[i].value;
+        totalWeight += records[i].weight;
+    }
+    if (totalValue != header.totalValue || totalWeight != header.totalWeight) {
+        error = "Totais do cabeçalho binário não correspondem aos itens (valor " + std::to_string(header.totalValue) +
+                " declarado, " + std::to_string(totalValue) + " somado; peso " + std::to_string(header.totalWeight) +
+                " declarado, " + std::to_string(totalWeight) + " somado)";
+        return false;
+    }
+
+    std::vector<int> ids(header.numItems);
+    for (std::uint64_t i = 0; i < header.numItems; ++i) {
+        ids[i] = records[i].id;
+    }
+    std::sort(ids.begin(), ids.end());
+    auto repeated = std::adjacent_find(ids.begin(), ids.end());
+    if (repeated != ids.end()) {
+        error = "Id de item repetido no formato binário: " + std::to_string(*repeated);
+        return false;
+    }
+    return true;
+}
+
+} // namespace
 
-    file.close();
+// --- MappedInstance ---
+
+MappedInstance::MappedInstance() : data_(nullptr), size_(0) {}
+
+MappedInstance::~MappedInstance() {
+    close();
+}
+
+void MappedInstance::close() {
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+}
+
+bool MappedInstance::open(const std::string& filePath, std::string& error) {
+    close();
+    if (!mapFile(filePath, data_, size_, error)) {
+        return false;
+    }
+    if (!isBinaryInstance(data_, size_)) {
+        error = "O arquivo não está no formato binário de instância: " + filePath;
+        close();
+        return false;
+    }
+    if (!validateBinaryHeader(header(), size_, error) || !validateBinaryRecords(header(), items(), error)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+const BinaryInstanceHeader& MappedInstance::header() const {
+    return *static_cast<const BinaryInstanceHeader*>(data_);
+}
+
+int MappedInstance::capacity() const {
+    return static_cast<int>(header().capacity);
+}
+
+std::size_t MappedInstance::numItems() const {
+    return static_cast<std::size_t>(header().numItems);
+}
+
+const Item* MappedInstance::items() const {
+    return reinterpret_cast<const Item*>(static_cast<const char*>(data_) + sizeof(BinaryInstanceHeader));
+}
+
+// --- Leitura ---
+
+bool loadKnapsackInstance(const std::string& filePath, int& capacity, std::vector<Item>& items,
+                          std::string& error) {
+    capacity = 0;
+    items.clear();
+
+    void* data = nullptr;
+    std::size_t size = 0;
+    if (!mapFile(filePath, data, size, error)) {
+        return false;
+    }
+
+    bool ok = false;
+    if (isBinaryInstance(data, size)) {
+        const BinaryInstanceHeader& header = *static_cast<const BinaryInstanceHeader*>(data);
+        const Item* records = reinterpret_cast<const Item*>(static_cast<const char*>(data) + sizeof(header));
+        if (validateBinaryHeader(header, size, error) && validateBinaryRecords(header, records, error)) {
+            capacity = static_cast<int>(header.capacity);
+            items.assign(records, records + header.numItems);
+            ok = true;
+        }
+    } else {
+        const char* text = static_cast<const char*>(data);
+        ok = parseTextInstance(text, text + size, capacity, items, error);
+    }
+
+    munmap(data, size);
+    if (!ok) {
+        error = filePath + ": " + error;
+        capacity = 0;
+        items.clear();
+    }
+    return ok;
+}
+
+std::pair<int, std::vector<Item>> readKnapsackInstance(const std::string& filename) {
+    int capacity = 0;
+    std::vector<Item> items;
+    std::string error;
+    if (!loadKnapsackInstance(filename, capacity, items, error)) {
+        std::cerr << error << std::endl;
+        return {0, {}};
+    }
     return {capacity, items};
-}
\ No newline at end of file
+}
+
+// --- Escrita ---
+
+bool writeTextInstance(const std::string& filePath, int capacity, const std::vector<Item>& items,
+                       std::string& error) {
+    std::ofstream file(filePath);
+    if (!file.is_open()) {
+        error = "Erro ao abrir o arquivo para escrita: " + filePath;
+        return false;
+    }
+
+    file << items.size() << "\n" << capacity << "\n";
+    for (const Item& item : items) {
+        file << item.value << " " << item.weight << "\n";
+    }
+
+    if (!file) {
+        error = "Erro ao escrever o arquivo: " + filePath;
+        return false;
+    }
+    return true;
+}
+
+bool writeBinaryInstance(const std::string& filePath, int capacity, const std::vector<Item>& items,
+                         std::string& error) {
+    std::ofstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        error = "Erro ao abrir o arquivo para escrita: " + filePath;
+        return false;
+    }
+
+    BinaryInstanceHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kBinaryMagic, sizeof(kBinaryMagic));
+    header.version = 1;
+    header.recordSize = sizeof(Item);
+    header.numItems = items.size();
+    header.capacity = capacity;
+    for (const Item& item : items) {
+        header.totalValue += item.value;
+        header.totalWeight += item.weight;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(items.data()), static_cast<std::streamsize>(items.size() * sizeof(Item)));
+
+    if (!file) {
+        error = "Erro ao escrever o arquivo: " + filePath;
+        return false;
+    }
+    return true;
+}
+
+bool convertInstance(const std::string& inputPath, const std::string& outputPath, std::string& error) {
+    void* data = nullptr;
+    std::size_t size = 0;
+    if (!mapFile(inputPath, data, size, error)) {
+        return false;
+    }
+    bool inputIsBinary = isBinaryInstance(data, size);
+    munmap(data, size);
+
+    int capacity = 0;
+    std::vector<Item> items;
+    if (!loadKnapsackInstance(inputPath, capacity, items, error)) {
+        return false;
+    }
+
+    return inputIsBinary
+        ? writeTextInstance(outputPath, capacity, items, error)
+        : writeBinaryInstance(outputPath, capacity, items, error);
+}
@@ -0,0 +1,67 @@
+// Verifica que o laço de iterações do ACO não aloca memória. Este teste e o núcleo que ele usa
+// são compilados com -DACO_COUNT_ALLOCATIONS (ver alloc_counter.h), então solve() também
+// confere com assert; aqui o valor é checado explicitamente para cada configuração.
+//
+//   make check
+
+#include "aco.h"
+#include "instance_generator.h"
+#include "local_search.h"
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FALHOU: " << what << std::endl;
+        ++failures;
+    }
+}
+
+struct Setup {
+    const char* name;
+    bool localSearch;
+    DuplicateCacheMode duplicateMode;
+    bool uniqueDeposits;
+};
+
+void testNoIterationAllocations(int numThreads, const Setup& setup) {
+    std::pair<int, std::vector<Item>> instance = generateInstance(InstanceClass::WeaklyCorrelated, 300, 11);
+    ACO aco(40, 0.3, 1.5, 2.5, instance.first, instance.second, 150, 9u, numThreads);
+    if (setup.localSearch) {
+        aco.setLocalSearch(std::make_shared<SwapLocalSearch>(instance.first, instance.second), 5);
+    }
+    aco.setDuplicateCache(setup.duplicateMode, setup.uniqueDeposits);
+    SolveResult result = aco.solve(SolveLimits());
+
+    std::string what = std::string(setup.name) + " com " + std::to_string(numThreads) + " thread(s)";
+    expect(result.bestValue > 0, what + ": sem solução viável");
+    expect(aco.getIterationAllocations() == 0,
+           what + ": " + std::to_string(aco.getIterationAllocations()) + " alocações no laço de iterações");
+}
+
+} // namespace
+
+int main() {
+    const Setup setups[] = {
+        {"ACO padrão", false, DuplicateCacheMode::Off, false},
+        {"busca local", true, DuplicateCacheMode::Off, false},
+        {"busca local + repetidas por iteração", true, DuplicateCacheMode::PerIteration, false},
+        {"busca local + repetidas globais + depósito único", true, DuplicateCacheMode::CrossIteration, true},
+    };
+    for (int numThreads : {1, 3}) {
+        for (const Setup& setup : setups) {
+            testNoIterationAllocations(numThreads, setup);
+        }
+    }
+    if (failures > 0) {
+        std::cerr << failures << " verificação(ões) falharam" << std::endl;
+        return 1;
+    }
+    std::cout << "allocation_test: ok" << std::endl;
+    return 0;
+}
@@ -0,0 +1,203 @@
+// Checkpoint do ACO: gravar e ler de volta preserva todos os campos, arquivos truncados ou com
+// cabeçalho inconsistente são recusados, e o warm start associa o feromônio por Item::id quando
+// itens são removidos, adicionados ou reordenados.
+//
+//   make check
+
+#include "aco.h"
+#include "aco_checkpoint.h"
+#include "instance_generator.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FALHOU: " << what << std::endl;
+        ++failures;
+    }
+}
+
+const std::string& checkpointPath() {
+    static const std::string path = (std::filesystem::temp_directory_path() / "aco_checkpoint_test.bin").string();
+    return path;
+}
+
+bool sameCheckpoint(const AcoCheckpoint& a, const AcoCheckpoint& b) {
+    return a.capacity == b.capacity && a.seed == b.seed && a.iterations == b.iterations && a.bestValue == b.bestValue &&
+           a.itemIds == b.itemIds && a.take == b.take && a.notTake == b.notTake && a.bestItemIds == b.bestItemIds;
+}
+
+std::vector<char> readBytes(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void writeBytes(const std::string& path, const std::vector<char>& bytes) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+AcoCheckpoint sampleCheckpoint() {
+    AcoCheckpoint checkpoint;
+    checkpoint.capacity = 1234;
+    checkpoint.seed = 4000000000u;
+    checkpoint.iterations = (1ULL << 40) + 7;
+    checkpoint.bestValue = -5;
+    checkpoint.itemIds = {17, 3, 42, 8};
+    checkpoint.take = {0.1, 1e-300, 3.5, 0.0};
+    checkpoint.notTake = {2.0, 0.25, -0.0, 7.125};
+    checkpoint.bestItemIds = {3, 42};
+    return checkpoint;
+}
+
+void testRoundTrip() {
+    std::string error;
+    AcoCheckpoint written = sampleCheckpoint();
+    AcoCheckpoint read;
+    expect(writeCheckpoint(checkpointPath(), written, error), "gravar checkpoint: " + error);
+    expect(readCheckpoint(checkpointPath(), read, error), "ler checkpoint: " + error);
+    expect(sameCheckpoint(written, read), "checkpoint lido difere do gravado");
+
+    // Vetores vazios também precisam sobreviver
+    AcoCheckpoint empty;
+    expect(writeCheckpoint(checkpointPath(), empty, error) && readCheckpoint(checkpointPath(), read, error) &&
+               sameCheckpoint(empty, read),
+           "checkpoint vazio");
+
+    // E o retrato de uma execução de verdade
+    std::pair<int, std::vector<Item>> instance = generateInstance(InstanceClass::StronglyCorrelated, 60, 5);
+    ACO aco(20, 0.2, 1.0, 2.0, instance.first, instance.second, 40, 3u);
+    aco.solve();
+    AcoCheckpoint fromRun = aco.checkpoint();
+    expect(writeCheckpoint(checkpointPath(), fromRun, error) && readCheckpoint(checkpointPath(), read, error) &&
+               sameCheckpoint(fromRun, read),
+           "checkpoint de uma execução");
+    expect(read.iterations == 40 && read.itemIds.size() == 60, "checkpoint de uma execução: iterações ou itens");
+}
+
+void expectRejected(const std::vector<char>& bytes, const std::string& what) {
+    writeBytes(checkpointPath(), bytes);
+    AcoCheckpoint read;
+    std::string error;
+    expect(!readCheckpoint(checkpointPath(), read, error), what + ": deveria ser recusado");
+    expect(!error.empty(), what + ": recusado sem mensagem de erro");
+}
+
+void testRejectedFiles() {
+    std::string error;
+    AcoCheckpoint bad = sampleCheckpoint();
+    bad.notTake.pop_back();
+    expect(!writeCheckpoint(checkpointPath(), bad, error), "gravar checkpoint com vetores de tamanhos diferentes");
+
+    expect(writeCheckpoint(checkpointPath(), sampleCheckpoint(), error), "gravar checkpoint: " + error);
+    const std::vector<char> good = readBytes(checkpointPath());
+    expect(good.size() == sizeof(CheckpointHeader) + 4 * (sizeof(int) + 2 * sizeof(double)) + 2 * sizeof(int),
+           "tamanho do arquivo gravado");
+
+    // Cortado em qualquer ponto: no cabeçalho, no meio dos vetores ou a um byte do fim
+    for (std::size_t size : {std::size_t(0), std::size_t(10), sizeof(CheckpointHeader), sizeof(CheckpointHeader) + 20,
+                             good.size() - sizeof(int), good.size() - 1}) {
+        expectRejected(std::vector<char>(good.begin(), good.begin() + size), "truncado em " + std::to_string(size) + " bytes");
+    }
+
+    std::vector<char> trailing = good;
+    trailing.insert(trailing.end(), {1, 2, 3});
+    expectRejected(trailing, "bytes sobrando no fim");
+
+    std::vector<char> magic = good;
+    magic[0] = 'X';
+    expectRejected(magic, "assinatura errada");
+
+    CheckpointHeader header;
+    std::vector<char> version = good;
+    std::memcpy(&header, version.data(), sizeof(header));
+    header.version = 2;
+    std::memcpy(version.data(), &header, sizeof(header));
+    expectRejected(version, "versão desconhecida");
+
+    // Contagens do cabeçalho que não batem com o tamanho do arquivo
+    std::vector<char> moreItems = good;
+    std::memcpy(&header, moreItems.data(), sizeof(header));
+    header.numItems = 5;
+    std::memcpy(moreItems.data(), &header, sizeof(header));
+    expectRejected(moreItems, "numItems maior que o arquivo");
+
+    std::vector<char> hugeItems = good;
+    header.numItems = ~0ULL / 2;
+    std::memcpy(hugeItems.data(), &header, sizeof(header));
+    expectRejected(hugeItems, "numItems enorme");
+
+    std::vector<char> moreBest = good;
+    std::memcpy(&header, moreBest.data(), sizeof(header));
+    header.numBestItems = 3;
+    std::memcpy(moreBest.data(), &header, sizeof(header));
+    expectRejected(moreBest, "numBestItems maior que o arquivo");
+}
+
+// Instância original com ids 1..6 e feromônio distinto por id; a nova remove os ids 2 e 5,
+// inverte a ordem dos restantes e acrescenta os ids 7 e 8 com a mesma razão valor/peso de um
+// sobrevivente (id 3 e id 6)
+void testWarmStartById() {
+    AcoCheckpoint checkpoint;
+    checkpoint.capacity = 100;
+    checkpoint.seed = 21;
+    checkpoint.iterations = 10;
+    for (int id = 1; id <= 6; ++id) {
+        checkpoint.itemIds.push_back(id);
+        checkpoint.take.push_back(0.1 * id);
+        checkpoint.notTake.push_back(1.0 + 0.1 * id);
+    }
+    checkpoint.bestItemIds = {1, 3};
+
+    // {id, valor, peso}; razões dos sobreviventes: id 1 = 10, id 3 = 5, id 4 = 2, id 6 = 40
+    const std::vector<Item> items = {{6, 40, 1}, {8, 80, 2}, {4, 20, 10}, {3, 25, 5}, {7, 25, 5}, {1, 100, 10}};
+    const int expectedSource[] = {6, 6, 4, 3, 3, 1};  // id cujo feromônio cada posição deve herdar
+
+    ACO aco(10, 0.1, 1.0, 2.0, 60, items, 5, checkpoint, 1, 0.0);
+    const AlignedDoubleVector& take = aco.getPheromoneTake();
+    const AlignedDoubleVector& notTake = aco.getPheromoneNotTake();
+    expect(take.size() == items.size() && notTake.size() == items.size(), "warm start: tamanho do feromônio");
+    for (std::size_t i = 0; i < items.size() && i < take.size(); ++i) {
+        const int source = expectedSource[i];
+        std::string what = "warm start, item de id " + std::to_string(items[i].id);
+        expect(take[i] == checkpoint.take[source - 1] && notTake[i] == checkpoint.notTake[source - 1],
+               what + ": esperava o feromônio do id " + std::to_string(source));
+    }
+
+    AcoCheckpoint after = aco.checkpoint();
+    expect(after.seed == checkpoint.seed && after.iterations == checkpoint.iterations, "warm start: seed e iterações");
+    std::vector<int> expectedIds;
+    for (const Item& item : items) {
+        expectedIds.push_back(item.id);
+    }
+    expect(after.itemIds == expectedIds, "warm start: ids do novo checkpoint na ordem da instância nova");
+
+    // A melhor solução antiga (ids 1 e 3, valor 125) é o ponto de partida
+    aco.solve();
+    expect(aco.getBestSolution().value() >= 125, "warm start: perdeu a melhor solução do checkpoint");
+}
+
+} // namespace
+
+int main() {
+    testRoundTrip();
+    testRejectedFiles();
+    testWarmStartById();
+    std::remove(checkpointPath().c_str());
+    if (failures > 0) {
+        std::cerr << failures << " verificação(ões) falharam" << std::endl;
+        return 1;
+    }
+    std::cout << "checkpoint_test: ok" << std::endl;
+    return 0;
+}
@@ -0,0 +1,175 @@
+// Solvers exatos: a programação dinâmica e o branch-and-bound precisam concordar entre si e com
+// a força bruta em instâncias pequenas, inclusive nos casos de borda (capacidade zero, um item,
+// todos os itens cabendo). Também confere o limite de memória de exactFastPathApplies.
+//
+//   make check
+
+#include "exact_solver.h"
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FALHOU: " << what << std::endl;
+        ++failures;
+    }
+}
+
+// Ótimo por enumeração de todos os subconjuntos (n <= 20)
+long long bruteForce(int capacity, const std::vector<Item>& items) {
+    const std::size_t n = items.size();
+    long long best = 0;
+    for (unsigned long mask = 0; mask < (1UL << n); ++mask) {
+        long long value = 0;
+        long long weight = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            if ((mask >> i) & 1UL) {
+                value += items[i].value;
+                weight += items[i].weight;
+            }
+        }
+        if (weight <= capacity && value > best) {
+            best = value;
+        }
+    }
+    return best;
+}
+
+// A solução devolvida precisa caber e valer exatamente o valor reportado
+void expectConsistent(int capacity, const std::vector<Item>& items, const ExactResult& result, const std::string& what) {
+    expect(result.optimal, what + ": não provou o ótimo");
+    expect(result.solution.size() == items.size(), what + ": solução com tamanho errado");
+    if (result.solution.size() != items.size()) {
+        return;
+    }
+    long long value = 0;
+    long long weight = 0;
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        if (result.solution[i] == 1) {
+            value += items[i].value;
+            weight += items[i].weight;
+        }
+    }
+    expect(weight <= capacity, what + ": solução estoura a capacidade");
+    expect(value == result.value, what + ": valor da solução (" + std::to_string(value) + ") difere do reportado (" +
+                                      std::to_string(result.value) + ")");
+}
+
+void checkInstance(int capacity, const std::vector<Item>& items, const std::string& what) {
+    long long expected = bruteForce(capacity, items);
+    ExactResult dp = solveByDynamicProgramming(capacity, items, true);
+    ExactResult dpValueOnly = solveByDynamicProgramming(capacity, items, false);
+    ExactResult bb = solveByBranchAndBound(capacity, items);
+    ExactResult chosen = solveExact(capacity, items);
+
+    expect(dp.value == expected, what + ": DP deu " + std::to_string(dp.value) + ", força bruta " + std::to_string(expected));
+    expect(dpValueOnly.value == expected && dpValueOnly.solution.empty(), what + ": DP sem reconstrução");
+    expect(bb.value == expected, what + ": branch-and-bound deu " + std::to_string(bb.value) + ", força bruta " +
+                                     std::to_string(expected));
+    expect(chosen.value == expected, what + ": solveExact");
+    expectConsistent(capacity, items, dp, what + " (DP)");
+    expectConsistent(capacity, items, bb, what + " (branch-and-bound)");
+}
+
+std::vector<Item> makeItems(const std::vector<std::pair<int, int>>& valueWeight) {
+    std::vector<Item> items;
+    for (const std::pair<int, int>& vw : valueWeight) {
+        items.push_back(Item{static_cast<int>(items.size()) + 1, vw.first, vw.second});
+    }
+    return items;
+}
+
+void testEdgeCases() {
+    const std::vector<Item> three = makeItems({{10, 5}, {7, 3}, {4, 4}});
+    checkInstance(0, three, "capacidade zero");
+    checkInstance(12, three, "todos cabem (soma exata)");
+    checkInstance(1000, three, "todos cabem com folga");
+    checkInstance(2, three, "nenhum cabe");
+    checkInstance(5, makeItems({{9, 5}}), "um item que cabe");
+    checkInstance(4, makeItems({{9, 5}}), "um item que não cabe");
+    checkInstance(10, {}, "sem itens");
+    // Razões empatadas e um item pesado demais no meio da ordem
+    checkInstance(10, makeItems({{6, 3}, {4, 2}, {100, 11}, {2, 1}, {8, 4}}), "razões empatadas");
+    // Peso zero (aceito pela leitura): sempre cabe, inclusive com capacidade zero
+    const std::vector<Item> free = makeItems({{5, 0}, {0, 0}, {7, 3}, {4, 0}, {9, 5}, {0, 2}});
+    checkInstance(0, free, "peso zero com capacidade zero");
+    checkInstance(4, free, "peso zero");
+}
+
+void testRandomInstances() {
+    std::mt19937 rng(2024);
+    for (int trial = 0; trial < 400; ++trial) {
+        const int n = 1 + static_cast<int>(rng() % 16);
+        const int range = (trial % 2 == 0) ? 20 : 1000;
+        std::vector<std::pair<int, int>> valueWeight;
+        long long totalWeight = 0;
+        for (int i = 0; i < n; ++i) {
+            int weight = (trial % 5 == 4) ? static_cast<int>(rng() % range) : 1 + static_cast<int>(rng() % range);
+            int value = (trial % 3 == 0) ? weight : 1 + static_cast<int>(rng() % range);  // Um terço subset sum
+            valueWeight.emplace_back(value, weight);
+            totalWeight += weight;
+        }
+        int capacity = static_cast<int>(rng() % (totalWeight + 2));
+        checkInstance(capacity, makeItems(valueWeight), "aleatória " + std::to_string(trial));
+    }
+}
+
+// Maior capacidade cuja DP com reconstrução cabe no limite de memória
+int largestCapacityWithinBudget(std::size_t numItems) {
+    long long lo = 0;
+    long long hi = 1LL << 31;
+    while (hi - lo > 1) {
+        long long mid = lo + (hi - lo) / 2;
+        if (dynamicProgrammingBytes(static_cast<int>(std::min<long long>(mid, 2147483647LL)), numItems, true) <=
+            kMaxDynamicProgrammingBytes) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return static_cast<int>(lo);
+}
+
+void testFastPathByteCap() {
+    const long long plentyOfAnts = 1LL << 40;
+    for (std::size_t numItems : {1, 3, 100}) {
+        int capacity = largestCapacityWithinBudget(numItems);
+        std::string what = std::to_string(numItems) + " itens, C = " + std::to_string(capacity);
+        expect(dynamicProgrammingBytes(capacity, numItems, true) <= kMaxDynamicProgrammingBytes &&
+                   dynamicProgrammingBytes(capacity + 1, numItems, true) > kMaxDynamicProgrammingBytes,
+               what + ": busca do limite");
+        expect(exactFastPathApplies(capacity, numItems, plentyOfAnts), what + ": atalho deveria valer no limite");
+        expect(!exactFastPathApplies(capacity + 1, numItems, plentyOfAnts), what + ": atalho não deveria valer acima do limite");
+    }
+
+    // Com poucos itens o vetor rolante domina: 3 itens e C = 2e9 pediriam 16 GB de DP
+    expect(!exactFastPathApplies(2000000000, 3, plentyOfAnts), "C enorme com 3 itens");
+    const std::vector<Item> few = makeItems({{5, 1000000000}, {4, 999999999}, {3, 3}});
+    ExactResult huge = solveExact(2000000000, few);
+    expect(huge.method == ExactMethod::BranchAndBound, "C enorme deveria ir para o branch-and-bound");
+    expect(huge.optimal && huge.value == bruteForce(2000000000, few), "C enorme: valor difere da força bruta");
+
+    // Abaixo do limite de memória, o atalho ainda depende do custo comparado ao das formigas
+    expect(exactFastPathApplies(1000, 100, 1000), "DP pequena vale a pena");
+    expect(!exactFastPathApplies(1000000, 100, 10), "DP maior que 10 formigas não vale a pena");
+}
+
+} // namespace
+
+int main() {
+    testEdgeCases();
+    testRandomInstances();
+    testFastPathByteCap();
+    if (failures > 0) {
+        std::cerr << failures << " verificação(ões) falharam" << std::endl;
+        return 1;
+    }
+    std::cout << "exact_solver_test: ok" << std::endl;
+    return 0;
+}
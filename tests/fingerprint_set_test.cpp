@@ -0,0 +1,107 @@
+// Cache de soluções repetidas: o FingerprintSet acerta e erra como um conjunto comum, esquece
+// tudo no clear() (inclusive quando o contador de gerações dá a volta) e se esvazia ao passar
+// da metade da tabela. O modo CrossIteration do ACO não pode mudar o melhor valor encontrado.
+//
+//   make check
+
+#include "aco.h"
+#include "fingerprint_set.h"
+#include "instance_generator.h"
+#include "local_search.h"
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FALHOU: " << what << std::endl;
+        ++failures;
+    }
+}
+
+void testHitAndMiss() {
+    FingerprintSet set;
+    set.reserve(100);
+    expect(set.insert(42, 0) == -1 && set.size() == 1, "primeira inserção deveria errar");
+    expect(set.insert(42, 7) == 0 && set.size() == 1, "repetida deveria acertar com o rótulo original");
+    // Mesmo slot inicial (diferem só acima da máscara): a sondagem linear separa as duas
+    expect(set.insert(42 + (1ULL << 40), 1) == -1, "colisão de slot não é repetida");
+    expect(set.insert(42 + (1ULL << 40), 9) == 1, "segunda chave do mesmo slot deveria acertar");
+    expect(set.insert(0, 2) == -1 && set.insert(0, 3) == 2, "impressão digital zero");
+    expect(set.size() == 3, "tamanho depois de três chaves distintas");
+
+    set.clear();
+    expect(set.size() == 0, "clear() deveria zerar o tamanho");
+    expect(set.insert(42, 5) == -1, "clear() deveria esquecer as chaves");
+    expect(set.insert(42, 6) == 5, "depois do clear() o rótulo é o da nova inserção");
+}
+
+// clear() só troca a geração; depois de 2^32 - 1 chamadas o contador volta a 1, e uma entrada
+// gravada na geração 1 não pode voltar a valer
+void testGenerationWraparound() {
+    FingerprintSet set;
+    set.reserve(4);
+    set.insert(1234, 3);
+    for (std::uint64_t k = 0; k < 0xFFFFFFFEULL; ++k) {
+        set.clear();
+    }
+    // Última geração antes da volta: grava uma entrada que também precisa sumir
+    set.insert(5678, 4);
+    expect(set.insert(5678, 0) == 4, "entrada da última geração antes da volta");
+    set.clear();
+    expect(set.insert(1234, 8) == -1, "entrada da geração 1 ressuscitou depois da volta do contador");
+    expect(set.insert(5678, 9) == -1, "entrada da geração anterior ressuscitou depois da volta do contador");
+    expect(set.size() == 2, "tamanho depois da volta do contador");
+}
+
+void testResetWhenHalfFull() {
+    FingerprintSet set;
+    set.reserve(8);  // 16 entradas na tabela
+    for (std::uint64_t key = 1; key <= 8; ++key) {
+        expect(set.insert(key * 1000003ULL, static_cast<int>(key)) == -1, "inserção até a metade");
+    }
+    expect(set.size() == 8, "tabela na metade");
+    expect(set.insert(3 * 1000003ULL, 0) == 3, "repetida com a tabela na metade");
+    expect(set.insert(99, 9) == -1 && set.size() == 1, "passar da metade deveria esvaziar antes de inserir");
+    expect(set.insert(1 * 1000003ULL, 10) == -1, "chaves anteriores ao esvaziamento deveriam sumir");
+    expect(set.insert(99, 0) == 9, "a chave que provocou o esvaziamento fica");
+}
+
+// Com a mesma seed, pular a avaliação de soluções já vistas não muda a trajetória nem o melhor valor
+void testCrossIterationMatchesOff() {
+    std::pair<int, std::vector<Item>> instance = generateInstance(InstanceClass::StronglyCorrelated, 200, 17);
+    for (bool localSearch : {false, true}) {
+        long long best[2] = {0, 0};
+        for (int k = 0; k < 2; ++k) {
+            ACO aco(30, 0.2, 1.0, 2.0, instance.first, instance.second, 200, 31u, 2);
+            if (localSearch) {
+                aco.setLocalSearch(std::make_shared<SwapLocalSearch>(instance.first, instance.second), 3);
+            }
+            aco.setDuplicateCache(k == 0 ? DuplicateCacheMode::Off : DuplicateCacheMode::CrossIteration);
+            best[k] = aco.solve(SolveLimits()).bestValue;
+        }
+        std::string what = localSearch ? "com busca local" : "sem busca local";
+        expect(best[0] == best[1], "CrossIteration " + what + " deu " + std::to_string(best[1]) + ", desligado " +
+                                       std::to_string(best[0]));
+    }
+}
+
+} // namespace
+
+int main() {
+    testHitAndMiss();
+    testGenerationWraparound();
+    testResetWhenHalfFull();
+    testCrossIterationMatchesOff();
+    if (failures > 0) {
+        std::cerr << failures << " verificação(ões) falharam" << std::endl;
+        return 1;
+    }
+    std::cout << "fingerprint_set_test: ok" << std::endl;
+    return 0;
+}
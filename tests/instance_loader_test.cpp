@@ -0,0 +1,245 @@
+// Leitura de instâncias (utils.h): os formatos texto e binário carregam os mesmos itens, e
+// arquivos truncados, com assinatura errada, totais que não batem, valores negativos ou ids
+// repetidos são recusados com uma mensagem. As instâncias são geradas num diretório temporário.
+//
+//   make check
+
+#include "utils.h"
+#include "instance_generator.h"
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FALHOU: " << what << std::endl;
+        ++failures;
+    }
+}
+
+std::string tempPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / ("aco_loader_test_" + name)).string();
+}
+
+void writeText(const std::string& path, const std::string& contents) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << contents;
+}
+
+// Arquivo binário escrito à mão, com o cabeçalho que o teste quiser (inclusive errado)
+void writeRawBinary(const std::string& path, const BinaryInstanceHeader& header, const std::vector<Item>& items,
+                    std::size_t keepBytes = SIZE_MAX) {
+    std::vector<char> bytes(sizeof(header) + items.size() * sizeof(Item));
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    if (!items.empty()) {
+        std::memcpy(bytes.data() + sizeof(header), items.data(), items.size() * sizeof(Item));
+    }
+    bytes.resize(std::min(keepBytes, bytes.size()));
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+// Cabeçalho correto para os itens dados
+BinaryInstanceHeader headerFor(int capacity, const std::vector<Item>& items) {
+    BinaryInstanceHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, "ACOKNAP1", 8);
+    header.version = 1;
+    header.recordSize = sizeof(Item);
+    header.numItems = items.size();
+    header.capacity = capacity;
+    for (const Item& item : items) {
+        header.totalValue += item.value;
+        header.totalWeight += item.weight;
+    }
+    return header;
+}
+
+bool sameItems(const std::vector<Item>& a, const std::vector<Item>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (a[i].id != b[i].id || a[i].value != b[i].value || a[i].weight != b[i].weight) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void expectLoads(const std::string& path, const std::string& what, int& capacity, std::vector<Item>& items) {
+    std::string error;
+    expect(loadKnapsackInstance(path, capacity, items, error), what + ": " + error);
+}
+
+void expectRejected(const std::string& path, const std::string& what) {
+    int capacity = -1;
+    std::vector<Item> items(1);
+    std::string error;
+    expect(!loadKnapsackInstance(path, capacity, items, error), what + ": deveria ser recusado");
+    expect(!error.empty(), what + ": recusado sem mensagem de erro");
+    expect(capacity == 0 && items.empty(), what + ": saída não foi zerada");
+}
+
+void testTextBinaryParity() {
+    std::pair<int, std::vector<Item>> instance = generateInstance(InstanceClass::WeaklyCorrelated, 500, 3);
+    instance.second[7].weight = 0;  // Peso zero é aceito nos dois formatos
+    instance.second[8].value = 0;
+    std::string error;
+    expect(writeTextInstance(tempPath("paridade.txt"), instance.first, instance.second, error), error);
+    expect(convertInstance(tempPath("paridade.txt"), tempPath("paridade.bin"), error), "texto para binário: " + error);
+    expect(convertInstance(tempPath("paridade.bin"), tempPath("paridade_volta.txt"), error), "binário para texto: " + error);
+
+    int textCapacity = 0;
+    int binaryCapacity = 0;
+    int roundTripCapacity = 0;
+    std::vector<Item> textItems;
+    std::vector<Item> binaryItems;
+    std::vector<Item> roundTripItems;
+    expectLoads(tempPath("paridade.txt"), "texto", textCapacity, textItems);
+    expectLoads(tempPath("paridade.bin"), "binário", binaryCapacity, binaryItems);
+    expectLoads(tempPath("paridade_volta.txt"), "texto convertido de volta", roundTripCapacity, roundTripItems);
+    expect(textCapacity == instance.first && sameItems(textItems, instance.second), "texto difere da instância gravada");
+    expect(binaryCapacity == textCapacity && sameItems(binaryItems, textItems), "binário difere do texto");
+    expect(roundTripCapacity == textCapacity && sameItems(roundTripItems, textItems), "ida e volta difere do texto");
+
+    MappedInstance mapped;
+    expect(mapped.open(tempPath("paridade.bin"), error), "MappedInstance: " + error);
+    expect(mapped.capacity() == textCapacity &&
+               sameItems(std::vector<Item>(mapped.items(), mapped.items() + mapped.numItems()), textItems),
+           "MappedInstance difere do texto");
+}
+
+void testRejectedBinary() {
+    const std::vector<Item> items = {{0, 10, 4}, {1, 7, 0}, {2, 3, 9}};
+    const BinaryInstanceHeader good = headerFor(10, items);
+    int capacity = 0;
+    std::vector<Item> loaded;
+    writeRawBinary(tempPath("bom.bin"), good, items);
+    expectLoads(tempPath("bom.bin"), "binário válido", capacity, loaded);
+
+    writeRawBinary(tempPath("truncado.bin"), good, items, sizeof(good) + 2 * sizeof(Item) + 5);
+    expectRejected(tempPath("truncado.bin"), "binário truncado num registro");
+    writeRawBinary(tempPath("truncado_cabecalho.bin"), good, items, sizeof(good) - 1);
+    expectRejected(tempPath("truncado_cabecalho.bin"), "binário truncado no cabeçalho");
+
+    BinaryInstanceHeader header = good;
+    header.magic[7] = '2';
+    writeRawBinary(tempPath("assinatura.bin"), header, items);
+    expectRejected(tempPath("assinatura.bin"), "assinatura errada");
+
+    header = good;
+    header.version = 2;
+    writeRawBinary(tempPath("versao.bin"), header, items);
+    expectRejected(tempPath("versao.bin"), "versão desconhecida");
+
+    header = good;
+    header.numItems = 4;
+    writeRawBinary(tempPath("contagem.bin"), header, items);
+    expectRejected(tempPath("contagem.bin"), "número de itens maior que o arquivo");
+
+    header = good;
+    header.capacity = static_cast<std::int64_t>(INT_MAX) + 1;
+    writeRawBinary(tempPath("capacidade.bin"), header, items);
+    expectRejected(tempPath("capacidade.bin"), "capacidade acima de INT_MAX");
+
+    header = good;
+    header.totalWeight += 1;
+    writeRawBinary(tempPath("total.bin"), header, items);
+    expectRejected(tempPath("total.bin"), "total de peso que não bate");
+
+    // Valor negativo com totais coerentes: só a regra de sinal pode recusar
+    std::vector<Item> negative = items;
+    negative[2].value = -3;
+    writeRawBinary(tempPath("negativo.bin"), headerFor(10, negative), negative);
+    expectRejected(tempPath("negativo.bin"), "valor negativo no binário");
+    negative = items;
+    negative[0].weight = -1;
+    writeRawBinary(tempPath("peso_negativo.bin"), headerFor(10, negative), negative);
+    expectRejected(tempPath("peso_negativo.bin"), "peso negativo no binário");
+
+    std::vector<Item> duplicated = items;
+    duplicated[2].id = 0;
+    writeRawBinary(tempPath("ids.bin"), headerFor(10, duplicated), duplicated);
+    expectRejected(tempPath("ids.bin"), "ids repetidos no binário");
+    MappedInstance mapped;
+    std::string error;
+    expect(!mapped.open(tempPath("ids.bin"), error), "MappedInstance com ids repetidos deveria ser recusada");
+}
+
+// Somas que não cabem em 32 bits: o cabeçalho guarda 64 bits, e um total truncado é recusado
+void testOverflowingTotals() {
+    const std::vector<Item> items = {{0, INT_MAX, INT_MAX}, {1, INT_MAX, INT_MAX}, {2, INT_MAX, 1}};
+    const BinaryInstanceHeader good = headerFor(INT_MAX, items);
+    expect(good.totalValue == 3LL * INT_MAX, "soma de 64 bits no cabeçalho");
+    int capacity = 0;
+    std::vector<Item> loaded;
+    writeRawBinary(tempPath("grande.bin"), good, items);
+    expectLoads(tempPath("grande.bin"), "totais acima de INT_MAX", capacity, loaded);
+    expect(capacity == INT_MAX && sameItems(loaded, items), "totais acima de INT_MAX: itens lidos");
+
+    BinaryInstanceHeader wrapped = good;
+    wrapped.totalValue = static_cast<std::int32_t>(static_cast<std::uint32_t>(good.totalValue));
+    writeRawBinary(tempPath("grande_truncado.bin"), wrapped, items);
+    expectRejected(tempPath("grande_truncado.bin"), "total de valor truncado em 32 bits");
+
+    writeText(tempPath("grande.txt"), "1\n10\n2147483648 1\n");
+    expectRejected(tempPath("grande.txt"), "valor acima de INT_MAX no texto");
+    writeText(tempPath("muitos.txt"), "4000000000\n10\n1 1\n");
+    expectRejected(tempPath("muitos.txt"), "número de itens acima de INT_MAX no texto");
+    writeText(tempPath("sem_espaco.txt"), "1000000\n10\n1 1\n");
+    expectRejected(tempPath("sem_espaco.txt"), "mais itens declarados do que cabem no arquivo");
+}
+
+void testRejectedText() {
+    int capacity = 0;
+    std::vector<Item> loaded;
+    writeText(tempPath("zero.txt"), "3\n10\n5 0\n0 4\n6 3\n");
+    expectLoads(tempPath("zero.txt"), "texto com peso e valor zero", capacity, loaded);
+    expect(loaded.size() == 3 && loaded[0].weight == 0 && loaded[1].value == 0 && loaded[2].id == 2,
+           "texto com peso e valor zero: itens lidos");
+
+    writeText(tempPath("valor_negativo.txt"), "2\n10\n5 1\n-3 4\n");
+    expectRejected(tempPath("valor_negativo.txt"), "valor negativo no texto");
+    writeText(tempPath("peso_negativo.txt"), "2\n10\n5 -1\n3 4\n");
+    expectRejected(tempPath("peso_negativo.txt"), "peso negativo no texto");
+    writeText(tempPath("capacidade_negativa.txt"), "1\n-10\n5 1\n");
+    expectRejected(tempPath("capacidade_negativa.txt"), "capacidade negativa no texto");
+    writeText(tempPath("truncado.txt"), "3\n10\n5 1\n3 4\n6");
+    expectRejected(tempPath("truncado.txt"), "texto truncado");
+    writeText(tempPath("sobra.txt"), "1\n10\n5 1\n3 4\n");
+    expectRejected(tempPath("sobra.txt"), "texto com dados além dos itens");
+    writeText(tempPath("lixo.txt"), "1\n10\n5 x\n");
+    expectRejected(tempPath("lixo.txt"), "texto com caractere inválido");
+    expectRejected(tempPath("nao_existe.txt"), "arquivo inexistente");
+}
+
+} // namespace
+
+int main() {
+    testTextBinaryParity();
+    testRejectedBinary();
+    testOverflowingTotals();
+    testRejectedText();
+    for (const std::filesystem::directory_entry& entry :
+         std::filesystem::directory_iterator(std::filesystem::temp_directory_path())) {
+        if (entry.path().filename().string().rfind("aco_loader_test_", 0) == 0) {
+            std::filesystem::remove(entry.path());
+        }
+    }
+    if (failures > 0) {
+        std::cerr << failures << " verificação(ões) falharam" << std::endl;
+        return 1;
+    }
+    std::cout << "instance_loader_test: ok" << std::endl;
+    return 0;
+}
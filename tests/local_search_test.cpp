@@ -0,0 +1,126 @@
+// Busca local por trocas: em instâncias e soluções aleatórias, improve() só pode melhorar a
+// solução sem estourar a capacidade, e as listas de candidatos que ficam na área de trabalho
+// precisam respeitar os invariantes documentados em LocalSearchScratch.
+//
+//   make check
+
+#include "local_search.h"
+#include "instance_generator.h"
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FALHOU: " << what << std::endl;
+        ++failures;
+    }
+}
+
+bool contains(const std::vector<int>& list, int idx) {
+    return std::find(list.begin(), list.end(), idx) != list.end();
+}
+
+// Posições estritamente crescentes (ascending) ou decrescentes na ordem de razão
+bool sortedByRank(const std::vector<int>& list, const std::vector<int>& rank, bool ascending) {
+    for (std::size_t k = 1; k < list.size(); ++k) {
+        int previous = rank[list[k - 1]];
+        int current = rank[list[k]];
+        if (ascending ? previous >= current : previous <= current) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void checkScratch(const Solution& solution, const LocalSearchScratch& scratch, const std::vector<int>& rank,
+                  const std::string& what) {
+    expect(sortedByRank(scratch.dropCandidates, rank, false), what + ": dropCandidates fora de ordem");
+    expect(sortedByRank(scratch.addCandidates, rank, true), what + ": addCandidates fora de ordem");
+    expect(sortedByRank(scratch.heavyCandidates, rank, true), what + ": heavyCandidates fora de ordem");
+    for (std::size_t i = 0; i < rank.size(); ++i) {
+        int idx = static_cast<int>(i);
+        std::size_t position = static_cast<std::size_t>(rank[i]);
+        bool inDrops = contains(scratch.dropCandidates, idx);
+        bool inAdds = contains(scratch.addCandidates, idx);
+        bool inHeavy = contains(scratch.heavyCandidates, idx);
+        std::string item = what + ", item " + std::to_string(i);
+        if (solution.test(i)) {
+            expect(!inAdds && !inHeavy, item + ": item de dentro numa lista de fora");
+            expect(position < scratch.dropCursor || inDrops, item + ": item de dentro já varrido fora da lista");
+        } else {
+            expect(!inDrops, item + ": item de fora na lista de dentro");
+            expect(!(inAdds && inHeavy), item + ": item de fora nas duas listas");
+            expect(position >= scratch.addCursor || inAdds || inHeavy,
+                   item + ": item de fora já varrido perdido pela varredura");
+        }
+    }
+}
+
+void testRandomInstances() {
+    std::mt19937 rng(7);
+    for (int trial = 0; trial < 1000; ++trial) {
+        int numItems = 1 + static_cast<int>(rng() % 300);
+        double capacityRatio = 0.05 + (rng() % 90) / 100.0;
+        InstanceClass instanceClass = allInstanceClasses()[rng() % allInstanceClasses().size()];
+        std::pair<int, std::vector<Item>> instance = generateInstance(instanceClass, numItems, rng(), 1000, capacityRatio);
+        const int capacity = instance.first;
+        const std::vector<Item>& items = instance.second;
+
+        int candidateListSize = 1 + static_cast<int>(rng() % 16);
+        SwapLocalSearch localSearch(capacity, items, candidateListSize, 1 + static_cast<int>(rng() % 40));
+        LocalSearchScratch scratch;
+        localSearch.prepare(scratch);
+
+        std::vector<int> order(items.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&items](int a, int b) {
+            long long lhs = static_cast<long long>(items[a].value) * items[b].weight;
+            long long rhs = static_cast<long long>(items[b].value) * items[a].weight;
+            return (lhs != rhs) ? lhs > rhs : a < b;
+        });
+        std::vector<int> rank(items.size());
+        for (std::size_t k = 0; k < order.size(); ++k) {
+            rank[order[k]] = static_cast<int>(k);
+        }
+
+        // A mesma área de trabalho é reaproveitada entre soluções, como no ACO
+        for (int repeat = 0; repeat < 3; ++repeat) {
+            Solution solution(items.size());
+            for (int idx : order) {
+                if (rng() % 3 == 0 && solution.weight() + items[idx].weight <= capacity) {
+                    solution.add(idx, items[idx].value, items[idx].weight);
+                }
+            }
+            long long before = solution.value();
+            localSearch.improve(solution, scratch);
+
+            std::string what = "tentativa " + std::to_string(trial) + "." + std::to_string(repeat);
+            expect(solution.weight() <= capacity, what + ": estourou a capacidade");
+            expect(solution.value() >= before, what + ": piorou a solução");
+            checkScratch(solution, scratch, rank, what);
+            if (failures > 0) {
+                return;
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    testRandomInstances();
+    if (failures > 0) {
+        std::cerr << failures << " verificação(ões) falharam" << std::endl;
+        return 1;
+    }
+    std::cout << "local_search_test: ok" << std::endl;
+    return 0;
+}
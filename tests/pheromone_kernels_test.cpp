@@ -0,0 +1,91 @@
+// Os kernels vetoriais de feromônio precisam dar exatamente o mesmo resultado da versão escalar
+// (pheromone_kernels.h). Compara evaporate e deposit de cada conjunto de instruções suportado pela
+// CPU com os escalares, em comprimentos que não são múltiplos da largura do vetor nem de 64.
+//
+//   make check
+
+#include "pheromone_kernels.h"
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FALHOU: " << what << std::endl;
+        ++failures;
+    }
+}
+
+// Igualdade bit a bit (== trataria 0.0 e -0.0 como iguais)
+bool sameBits(const std::vector<double>& a, const std::vector<double>& b) {
+    return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0);
+}
+
+// Feromônios em [0, 0.2): com fator 0.7 e piso 0.01, parte das entradas fica presa no piso
+std::vector<double> randomPheromone(std::size_t n, std::mt19937_64& rng) {
+    std::uniform_real_distribution<double> dist(0.0, 0.2);
+    std::vector<double> values(n);
+    for (double& v : values) {
+        v = dist(rng);
+    }
+    return values;
+}
+
+void compareWithScalar(const PheromoneKernels& kernels, std::size_t n) {
+    const PheromoneKernels& scalar = pheromoneKernelsFor(KernelIsa::Scalar);
+    const std::string what = std::string(kernels.name) + ", n = " + std::to_string(n);
+    std::mt19937_64 rng(n);
+
+    std::vector<double> expected = randomPheromone(n, rng);
+    std::vector<double> actual = expected;
+    std::size_t expectedHits = scalar.evaporate(expected.data(), n, 0.7, 0.01);
+    std::size_t actualHits = kernels.evaporate(actual.data(), n, 0.7, 0.01);
+    expect(actualHits == expectedHits, what + ": evaporate devolveu " + std::to_string(actualHits) +
+                                           " entradas no piso, a escalar " + std::to_string(expectedHits));
+    expect(sameBits(actual, expected), what + ": evaporate difere da escalar");
+
+    // Uma palavra a mais, com bits ligados além de n, para conferir que o resto é ignorado
+    std::vector<std::uint64_t> bits((n + 63) / 64 + 1);
+    for (std::uint64_t& word : bits) {
+        word = rng();
+    }
+    std::vector<double> expectedTake = randomPheromone(n, rng);
+    std::vector<double> expectedNotTake = randomPheromone(n, rng);
+    std::vector<double> actualTake = expectedTake;
+    std::vector<double> actualNotTake = expectedNotTake;
+    scalar.deposit(expectedTake.data(), expectedNotTake.data(), bits.data(), n, 1.37);
+    kernels.deposit(actualTake.data(), actualNotTake.data(), bits.data(), n, 1.37);
+    expect(sameBits(actualTake, expectedTake), what + ": deposit difere da escalar em take");
+    expect(sameBits(actualNotTake, expectedNotTake), what + ": deposit difere da escalar em notTake");
+}
+
+} // namespace
+
+int main() {
+    const std::pair<KernelIsa, const char*> vectorIsas[] = {
+        {KernelIsa::SSE2, "sse2"}, {KernelIsa::AVX2, "avx2"}, {KernelIsa::AVX512, "avx512"}};
+    for (const std::pair<KernelIsa, const char*>& isa : vectorIsas) {
+        const PheromoneKernels& kernels = pheromoneKernelsFor(isa.first);
+        if (kernels.isa != isa.first) {
+            std::cout << "pheromone_kernels_test: " << isa.second << " sem suporte nesta CPU, pulado" << std::endl;
+            continue;
+        }
+        for (std::size_t n : {1, 7, 33, 64, 65, 1001}) {
+            compareWithScalar(kernels, n);
+        }
+    }
+    if (failures > 0) {
+        std::cerr << failures << " verificação(ões) falharam" << std::endl;
+        return 1;
+    }
+    std::cout << "pheromone_kernels_test: ok" << std::endl;
+    return 0;
+}
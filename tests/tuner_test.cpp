@@ -0,0 +1,121 @@
+// Teste do Friedman/Conover do ajuste por corrida contra uma tabela calculada à mão.
+//
+//   make check
+
+#include "tuner.h"
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "FALHOU: " << what << std::endl;
+        ++failures;
+    }
+}
+
+void expectNear(double actual, double expected, double tolerance, const std::string& what) {
+    expect(std::fabs(actual - expected) <= tolerance,
+           what + ": esperado " + std::to_string(expected) + ", obtido " + std::to_string(actual));
+}
+
+// 4 candidatas (A, B, C, D) em 6 blocos; values[c][bloco], maior é melhor.
+//
+//   bloco   A   B   C   D     postos A  B    C    D
+//     1    30  20  10  25             1  3    4    2
+//     2    30  10  20  25             1  4    3    2
+//     3    30  20  10  25             1  3    4    2
+//     4    20  30  10  25             3  1    4    2
+//     5    30  20  20  10             1  2.5  2.5  4
+//     6    30  25  10  20             1  2    4    3
+//   soma                              8  15.5 21.5 15
+//
+//   A = soma dos quadrados dos postos = 5 * 30 + 29.5 = 179.5
+//   C = b k (k+1)^2 / 4 = 6 * 4 * 25 / 4 = 150
+//   T = (k-1) soma (Rj - b(k+1)/2)^2 / (A - C) = 3 * (49 + 0.25 + 42.25 + 0) / 29.5 = 9.30508
+//       > qui-quadrado(0.95; 3) = 7.815, o teste rejeita
+//   soma Rj^2 = 64 + 240.25 + 462.25 + 225 = 991.5
+//   diferença crítica = t(0.975; 15) sqrt(2 b (A - soma Rj^2 / b) / 15)
+//                     = 2.13145 * sqrt(12 * 14.25 / 15) = 7.19661
+//   B (15.5 - 8 = 7.5) e C (13.5) saem; D (7.0) fica. Aplicar de novo o fator 1 - T/(b(k-1))
+//   daria 5.0018 e eliminaria D, que está empatada com B dentro do nível do teste.
+void testHandComputedTable() {
+    const std::vector<std::vector<int>> values = {
+        {30, 30, 30, 20, 30, 30},
+        {20, 10, 20, 30, 20, 25},
+        {10, 20, 10, 10, 20, 10},
+        {25, 25, 25, 25, 10, 20},
+    };
+    FriedmanOutcome outcome = friedmanConover(values, {0, 1, 2, 3}, 6, 0.95);
+
+    expect(outcome.rankSums.size() == 4, "uma soma de postos por candidata");
+    if (outcome.rankSums.size() == 4) {
+        expectNear(outcome.rankSums[0], 8.0, 1e-12, "soma de postos de A");
+        expectNear(outcome.rankSums[1], 15.5, 1e-12, "soma de postos de B");
+        expectNear(outcome.rankSums[2], 21.5, 1e-12, "soma de postos de C");
+        expectNear(outcome.rankSums[3], 15.0, 1e-12, "soma de postos de D");
+    }
+    expectNear(outcome.statistic, 274.5 / 29.5, 1e-9, "estatística T");
+    expectNear(outcome.criticalDifference, 7.19661, 1e-3, "diferença crítica");
+    expect(outcome.discarded == std::vector<int>({1, 2}), "eliminadas B e C, mantida D");
+}
+
+// Só as candidatas vivas entram: sem C, os postos de cada bloco são refeitos entre A, B e D
+void testAliveSubset() {
+    const std::vector<std::vector<int>> values = {
+        {30, 30, 30, 20, 30, 30},
+        {20, 10, 20, 30, 20, 25},
+        {10, 20, 10, 10, 20, 10},
+        {25, 25, 25, 25, 10, 20},
+    };
+    FriedmanOutcome outcome = friedmanConover(values, {0, 1, 3}, 6, 0.95);
+    expect(outcome.rankSums.size() == 3, "uma soma de postos por candidata viva");
+    if (outcome.rankSums.size() == 3) {
+        expectNear(outcome.rankSums[0], 8.0, 1e-12, "soma de postos de A entre vivas");
+        expectNear(outcome.rankSums[1], 14.0, 1e-12, "soma de postos de B entre vivas");
+        expectNear(outcome.rankSums[2], 14.0, 1e-12, "soma de postos de D entre vivas");
+    }
+}
+
+// Todas empatadas em todos os blocos: nada a testar, ninguém sai
+void testAllTied() {
+    const std::vector<std::vector<int>> values = {{7, 7, 7}, {7, 7, 7}, {7, 7, 7}};
+    FriedmanOutcome outcome = friedmanConover(values, {0, 1, 2}, 3, 0.95);
+    expectNear(outcome.statistic, 0.0, 0.0, "T com tudo empatado");
+    expect(outcome.discarded.empty(), "ninguém sai com tudo empatado");
+}
+
+// Duas candidatas em 128 blocos, sem empates: A vence 75 e perde 53. Com k = 2,
+// T = 4 (53 - 64)^2 / 128 = 3.78125, abaixo de qui-quadrado(0.95; 1) = 1.95996^2 = 3.84146:
+// o teste não rejeita (Wilson-Hilferty daria 3.747 e eliminaria B cedo demais)
+void testTwoSurvivors() {
+    std::vector<std::vector<int>> values(2, std::vector<int>(128));
+    for (int block = 0; block < 128; ++block) {
+        values[0][block] = (block < 75) ? 2 : 1;
+        values[1][block] = (block < 75) ? 1 : 2;
+    }
+    FriedmanOutcome outcome = friedmanConover(values, {0, 1}, 128, 0.95);
+    expectNear(outcome.statistic, 3.78125, 1e-9, "T com duas candidatas");
+    expect(outcome.discarded.empty(), "T abaixo do quantil exato com 1 grau de liberdade não elimina");
+    expectNear(outcome.criticalDifference, 0.0, 0.0, "sem diferença crítica quando T não rejeita");
+}
+
+} // namespace
+
+int main() {
+    testHandComputedTable();
+    testAliveSubset();
+    testAllTied();
+    testTwoSurvivors();
+    if (failures > 0) {
+        std::cerr << failures << " verificação(ões) falharam" << std::endl;
+        return 1;
+    }
+    std::cout << "tuner_test: ok" << std::endl;
+    return 0;
+}
@@ -0,0 +1,55 @@
+"""Leitor do traço de convergência gravado por TraceWriter (include/trace_writer.h).
+
+O arquivo é gerado com `build/programa --traco traco_convergencia.bin`. Uso no notebook:
+
+    from traco_aco import ler_traco
+    traco = ler_traco("traco_convergencia.bin")  # DataFrame, uma linha por iteração de cada execução
+"""
+
+import numpy as np
+import pandas as pd
+
+_MAGIC = b"ACOTRC01"
+_TIPOS = {b"u": "<u", b"i": "<i", b"f": "<f"}
+
+
+def ler_colunas(caminho):
+    """Devolve um dicionário nome da coluna -> numpy.ndarray, na ordem do arquivo."""
+    with open(caminho, "rb") as arquivo:
+        dados = arquivo.read()
+
+    if dados[:8] != _MAGIC:
+        raise ValueError(f"{caminho}: não é um traço do ACO (cabeçalho {dados[:8]!r})")
+    versao, num_colunas = np.frombuffer(dados, dtype="<u4", count=2, offset=8)
+    if versao != 1:
+        raise ValueError(f"{caminho}: versão {versao} do traço não suportada")
+
+    colunas = []
+    posicao = 16
+    for _ in range(num_colunas):
+        nome = dados[posicao:posicao + 16].split(b"\0", 1)[0].decode()
+        tipo = dados[posicao + 16:posicao + 17]
+        tamanho = dados[posicao + 17]
+        colunas.append((nome, np.dtype(f"{_TIPOS[tipo]}{tamanho}")))
+        posicao += 24
+
+    # Cada bloco: rowCount (u32), reservado (u32) e as colunas, uma após a outra
+    partes = {nome: [] for nome, _ in colunas}
+    while posicao < len(dados):
+        linhas = int(np.frombuffer(dados, dtype="<u4", count=1, offset=posicao)[0])
+        posicao += 8
+        for nome, dtype in colunas:
+            partes[nome].append(np.frombuffer(dados, dtype=dtype, count=linhas, offset=posicao))
+            posicao += linhas * dtype.itemsize
+
+    return {nome: np.concatenate(partes[nome]) if partes[nome] else np.empty(0, dtype)
+            for nome, dtype in colunas}
+
+
+def ler_traco(caminho):
+    """Traço como DataFrame ordenado por execução e iteração.
+
+    A coluna entropia só é medida a cada 16 iterações (kTraceEntropyInterval); nas demais é NaN.
+    """
+    traco = pd.DataFrame(ler_colunas(caminho))
+    return traco.sort_values(["execucao", "iteracao"], ignore_index=True)